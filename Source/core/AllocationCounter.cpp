@@ -0,0 +1,118 @@
+#include "AllocationCounter.h"
+
+#if REALLYCHEAP_COUNT_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+// Initial-exec TLS never allocates on first access, which matters because
+// the counters are read from inside malloc itself
+#if defined(__GNUC__)
+ #define REALLYCHEAP_THREAD_LOCAL __thread __attribute__((tls_model("initial-exec")))
+#else
+ #define REALLYCHEAP_THREAD_LOCAL thread_local
+#endif
+
+namespace
+{
+    REALLYCHEAP_THREAD_LOCAL int armedDepth = 0;
+    REALLYCHEAP_THREAD_LOCAL long long allocationCount = 0;
+
+    inline void countAllocation() noexcept
+    {
+        if (armedDepth > 0)
+            ++allocationCount;
+    }
+}
+
+#if defined(__GLIBC__)
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void __libc_free(void*);
+
+    // juce::HeapBlock (and so AudioBuffer) allocates through these rather than operator new
+    void* malloc(size_t size)                { countAllocation(); return __libc_malloc(size); }
+    void* calloc(size_t count, size_t size)  { countAllocation(); return __libc_calloc(count, size); }
+    void* realloc(void* ptr, size_t size)    { countAllocation(); return __libc_realloc(ptr, size); }
+    void free(void* ptr)                     { __libc_free(ptr); }
+}
+
+// operator new below counts for itself, so it must not go through the counting malloc
+static inline void* rawAllocate(std::size_t size) noexcept { return __libc_malloc(size); }
+static inline void rawFree(void* ptr) noexcept             { __libc_free(ptr); }
+#else
+static inline void* rawAllocate(std::size_t size) noexcept { return std::malloc(size); }
+static inline void rawFree(void* ptr) noexcept             { std::free(ptr); }
+#endif
+
+void* operator new(std::size_t size)
+{
+    countAllocation();
+
+    if (auto* ptr = rawAllocate(size != 0 ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    countAllocation();
+    return rawAllocate(size != 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept                           { rawFree(ptr); }
+void operator delete[](void* ptr) noexcept                         { rawFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept              { rawFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept            { rawFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept    { rawFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept  { rawFree(ptr); }
+
+#endif
+
+namespace ReallyCheap
+{
+
+#if REALLYCHEAP_COUNT_ALLOCATIONS
+
+AllocationCounter::ScopedAudioThreadCheck::ScopedAudioThreadCheck(std::atomic<juce::int64>& totalAllocations) noexcept
+    : total(totalAllocations), startCount(allocationCount)
+{
+    ++armedDepth;
+}
+
+AllocationCounter::ScopedAudioThreadCheck::~ScopedAudioThreadCheck() noexcept
+{
+    --armedDepth;
+
+    const auto newAllocations = static_cast<juce::int64>(allocationCount - startCount);
+
+    if (newAllocations > 0 && total.fetch_add(newAllocations) == 0)
+    {
+        // Heap allocation inside processBlock. Break here, or run the offline renderer
+        // in a debug build, which prints the running total after every file.
+        jassertfalse;
+    }
+}
+
+#else
+
+AllocationCounter::ScopedAudioThreadCheck::ScopedAudioThreadCheck(std::atomic<juce::int64>&) noexcept {}
+AllocationCounter::ScopedAudioThreadCheck::~ScopedAudioThreadCheck() noexcept {}
+
+#endif
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// Counting replaces the global allocation functions, so only the executables that link the
+// processor directly turn it on (in their debug builds); the plugin never does
+#ifndef REALLYCHEAP_COUNT_ALLOCATIONS
+ #define REALLYCHEAP_COUNT_ALLOCATIONS 0
+#endif
+
+namespace ReallyCheap
+{
+
+/**
+ * AllocationCounter - flags heap allocations made on the audio thread
+ *
+ * With REALLYCHEAP_COUNT_ALLOCATIONS set, the global operator new family is
+ * replaced (and, on glibc, malloc/calloc/realloc, which is what juce::HeapBlock
+ * and AudioBuffer use).
+ * Allocations are only counted on a thread while a ScopedAudioThreadCheck is
+ * alive there, so other threads and other instances are unaffected.
+ *
+ * Only ReallyCheap-Render sets it, and only in debug builds: replacing the
+ * allocator inside a plugin would replace it for the whole host process, so
+ * the plugin target leaves it unset, and there as in every release build none
+ * of this is compiled and the check is a no-op.
+ */
+class AllocationCounter
+{
+public:
+    static constexpr bool isEnabled() noexcept { return REALLYCHEAP_COUNT_ALLOCATIONS != 0; }
+
+    // Counts allocations on the calling thread for its lifetime and adds them to
+    // totalAllocations. Asserts the first time an instance's total becomes non-zero.
+    class ScopedAudioThreadCheck
+    {
+    public:
+        explicit ScopedAudioThreadCheck(std::atomic<juce::int64>& totalAllocations) noexcept;
+        ~ScopedAudioThreadCheck() noexcept;
+
+    private:
+       #if REALLYCHEAP_COUNT_ALLOCATIONS
+        std::atomic<juce::int64>& total;
+        juce::int64 startCount = 0;
+       #endif
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedAudioThreadCheck)
+    };
+};
+
+}
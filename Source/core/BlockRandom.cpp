@@ -0,0 +1,145 @@
+#include "BlockRandom.h"
+
+namespace ReallyCheap
+{
+
+namespace
+{
+    // SplitMix64, the recommended way to expand one seed into xoshiro state
+    juce::uint64 splitMix64(juce::uint64& state) noexcept
+    {
+        juce::uint64 z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    inline juce::uint32 rotateLeft(juce::uint32 x, int k) noexcept
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+}
+
+BlockRandom::BlockRandom()
+{
+    setSeedRandomly();
+}
+
+void BlockRandom::setSeed(juce::uint64 seed) noexcept
+{
+    juce::uint64 state = seed;
+
+    for (int lane = 0; lane < numStreams; ++lane)
+    {
+        const auto a = splitMix64(state);
+        const auto b = splitMix64(state);
+
+        s0[lane] = static_cast<juce::uint32>(a);
+        s1[lane] = static_cast<juce::uint32>(a >> 32);
+        s2[lane] = static_cast<juce::uint32>(b);
+        s3[lane] = static_cast<juce::uint32>(b >> 32);
+
+        // An all-zero state would only ever produce zeros
+        if ((s0[lane] | s1[lane] | s2[lane] | s3[lane]) == 0)
+            s0[lane] = 1;
+    }
+
+    outputUsed = numStreams;
+}
+
+void BlockRandom::setSeedRandomly() noexcept
+{
+    setSeed(static_cast<juce::uint64>(juce::Random::getSystemRandom().nextInt64())
+            ^ static_cast<juce::uint64>(juce::Time::getHighResolutionTicks()));
+}
+
+void BlockRandom::step() noexcept
+{
+    // xoshiro128+ on every stream at once; the loop has no cross-lane dependency
+    for (int lane = 0; lane < numStreams; ++lane)
+    {
+        const juce::uint32 result = s0[lane] + s3[lane];
+        const juce::uint32 t = s1[lane] << 9;
+
+        s2[lane] ^= s0[lane];
+        s3[lane] ^= s1[lane];
+        s1[lane] ^= s2[lane];
+        s0[lane] ^= s3[lane];
+        s2[lane] ^= t;
+        s3[lane] = rotateLeft(s3[lane], 11);
+
+        // Top 24 bits map exactly onto the float grid of [0, 2)
+        output[lane] = static_cast<float>(result >> 8) * (1.0f / 8388608.0f) - 1.0f;
+    }
+}
+
+void BlockRandom::fillUniform(float* dest, int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; i += numStreams)
+    {
+        step();
+
+        const int count = juce::jmin(numStreams, numSamples - i);
+        for (int lane = 0; lane < count; ++lane)
+            dest[i + lane] = output[lane];
+    }
+
+    outputUsed = numStreams;
+}
+
+void BlockRandom::fillTPDF(float* dest, int numSamples) noexcept
+{
+    alignas(32) float first[numStreams];
+
+    for (int i = 0; i < numSamples; i += numStreams)
+    {
+        step();
+        std::copy(output, output + numStreams, first);
+        step();
+
+        const int count = juce::jmin(numStreams, numSamples - i);
+        for (int lane = 0; lane < count; ++lane)
+            dest[i + lane] = (first[lane] + output[lane]) * 0.5f;
+    }
+
+    outputUsed = numStreams;
+}
+
+void BlockRandom::fillGaussian(float* dest, int numSamples) noexcept
+{
+    // Each uniform on [-1, 1) has variance 1/3, so four of them sum to 4/3
+    const float normalise = std::sqrt(3.0f / 4.0f);
+    alignas(32) float sum[numStreams];
+
+    for (int i = 0; i < numSamples; i += numStreams)
+    {
+        step();
+        std::copy(output, output + numStreams, sum);
+
+        for (int draw = 1; draw < 4; ++draw)
+        {
+            step();
+            for (int lane = 0; lane < numStreams; ++lane)
+                sum[lane] += output[lane];
+        }
+
+        const int count = juce::jmin(numStreams, numSamples - i);
+        for (int lane = 0; lane < count; ++lane)
+            dest[i + lane] = sum[lane] * normalise;
+    }
+
+    outputUsed = numStreams;
+}
+
+float BlockRandom::nextFloat() noexcept
+{
+    if (outputUsed >= numStreams)
+    {
+        step();
+        outputUsed = 0;
+    }
+
+    return output[outputUsed++];
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ReallyCheap
+{
+
+/**
+ * BlockRandom - per-instance noise source for the DSP modules
+ *
+ * Runs numStreams independent xoshiro128+ generators side by side, kept as
+ * structure-of-arrays so one step of all of them compiles to a handful of
+ * vector instructions. Modules fill a whole block of noise in one call and
+ * read it back from scratch memory instead of drawing numbers inline.
+ *
+ * Seeded randomly on construction. setSeed() makes every later draw
+ * reproducible, which is what offline renders and tests want.
+ */
+class BlockRandom
+{
+public:
+    static constexpr int numStreams = 8;
+
+    BlockRandom();
+
+    // Restarts all streams from a fixed seed (message thread, or before processing starts)
+    void setSeed(juce::uint64 seed) noexcept;
+    void setSeedRandomly() noexcept;
+
+    // Uniform on [-1, 1)
+    void fillUniform(float* dest, int numSamples) noexcept;
+
+    // Triangular on (-1, 1): the mean of two uniforms, as used for TPDF dither
+    void fillTPDF(float* dest, int numSamples) noexcept;
+
+    // Zero mean, unit variance; Irwin-Hall sum of four uniforms, so it stops at +-3.46
+    void fillGaussian(float* dest, int numSamples) noexcept;
+
+    // Single uniform value on [-1, 1), for the odd draw that is not worth a block
+    float nextFloat() noexcept;
+
+private:
+    void step() noexcept;
+
+    alignas(32) juce::uint32 s0[numStreams] {};
+    alignas(32) juce::uint32 s1[numStreams] {};
+    alignas(32) juce::uint32 s2[numStreams] {};
+    alignas(32) juce::uint32 s3[numStreams] {};
+    alignas(32) float output[numStreams] {};
+    int outputUsed = numStreams;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BlockRandom)
+};
+
+}
@@ -1,5 +1,6 @@
 #include "MacroController.h"
 #include "Params.h"
+#include "ParamSnapshot.h"
 
 namespace ReallyCheap
 {
@@ -22,24 +23,12 @@ void MacroController::reset() noexcept
     updateScalingFactors();
 }
 
-void MacroController::tick(const juce::AudioProcessorValueTreeState& apvts) noexcept
+void MacroController::tick(const ParamSnapshot& params) noexcept
 {
-    // Get current macro value and apply smoothing
-    auto macroParam = apvts.getRawParameterValue(ParameterIDs::macroReallyCheap);
-    if (macroParam != nullptr)
-    {
-        const float targetMacro = *macroParam;
-        smoothedMacro_ = smoothedMacro_ * macroSmoothingCoeff_ + targetMacro * (1.0f - macroSmoothingCoeff_);
-        updateScalingFactors();
-        
-        // Debug output
-        static int debugCount = 0;
-        if (debugCount < 10 || (debugCount % 1000 == 0))
-        {
-            DBG("Macro - raw: " << targetMacro << ", smoothed: " << smoothedMacro_ << ", wobbleGain: " << wobbleDepthGain());
-            debugCount++;
-        }
-    }
+    // Apply smoothing to the current macro value
+    const float targetMacro = params.macroReallyCheap;
+    smoothedMacro_ = smoothedMacro_ * macroSmoothingCoeff_ + targetMacro * (1.0f - macroSmoothingCoeff_);
+    updateScalingFactors();
 }
 
 void MacroController::updateScalingFactors() noexcept
@@ -150,14 +139,6 @@ void MacroController::updateScalingFactors() noexcept
     {
         noiseAgeGain_ = lerp(1.0f, 1.3f, ease(saturate((m - 0.5f) / 0.5f)));
     }
-    
-    // Debug output of key scaling factors
-    static int scalingDebugCount = 0;
-    if (scalingDebugCount < 20 || (scalingDebugCount % 500 == 0))
-    {
-        DBG("MacroController scalars - m: " << m << ", wobbleDepth: " << wobbleDepthGain_ << ", magneticComp: " << magneticCompGain_ << ", distortAdd: " << distortDriveAddDb_);
-        scalingDebugCount++;
-    }
 }
 
 //============================================================================
@@ -5,6 +5,8 @@
 namespace ReallyCheap
 {
 
+struct ParamSnapshot;
+
 /**
  * Centralized Macro Controller that reads macroReallyCheap and computes
  * per-module modulation factors with musical curves and guardrails.
@@ -31,11 +33,11 @@ public:
     void reset() noexcept;
     
     /**
-     * Update macro state by reading APVTS macro value.
+     * Update macro state from the block's parameter snapshot.
      * Called from processBlock on audio thread before module processing.
      * Updates internal smoothed scalars.
      */
-    void tick(const juce::AudioProcessorValueTreeState& apvts) noexcept;
+    void tick(const ParamSnapshot& params) noexcept;
     
     // Getters for module scaling factors (audio thread safe)
     // These return pre-smoothed, bounded scalars
@@ -0,0 +1,152 @@
+#include "ParamSnapshot.h"
+
+namespace ReallyCheap
+{
+
+namespace
+{
+    inline void load(const std::atomic<float>* value, float& target) noexcept
+    {
+        if (value != nullptr)
+            target = value->load(std::memory_order_relaxed);
+    }
+
+    inline void load(const std::atomic<float>* value, int& target) noexcept
+    {
+        if (value != nullptr)
+            target = static_cast<int>(value->load(std::memory_order_relaxed));
+    }
+
+    inline void load(const std::atomic<float>* value, bool& target) noexcept
+    {
+        if (value != nullptr)
+            target = value->load(std::memory_order_relaxed) > 0.5f;
+    }
+}
+
+void ParameterCache::attach(juce::AudioProcessorValueTreeState& apvts)
+{
+    auto get = [&apvts](const char* parameterID)
+    {
+        auto* value = apvts.getRawParameterValue(parameterID);
+        jassert(value != nullptr); // ID missing from ParameterHelper::createParameterLayout
+        return value;
+    };
+
+    values.inGain = get(ParameterIDs::inGain);
+    values.outGain = get(ParameterIDs::outGain);
+    values.mix = get(ParameterIDs::mix);
+    values.macroReallyCheap = get(ParameterIDs::macroReallyCheap);
+    values.bypass = get(ParameterIDs::bypass);
+    values.chainOversampling = get(ParameterIDs::chainOversampling);
+
+    values.noiseOn = get(ParameterIDs::noiseOn);
+    values.noiseType = get(ParameterIDs::noiseType);
+    values.noiseLevel = get(ParameterIDs::noiseLevel);
+    values.noiseAge = get(ParameterIDs::noiseAge);
+    values.noiseFlutterGate = get(ParameterIDs::noiseFlutterGate);
+    values.noiseWidth = get(ParameterIDs::noiseWidth);
+    values.noisePlacement = get(ParameterIDs::noisePlacement);
+
+    values.wobbleOn = get(ParameterIDs::wobbleOn);
+    values.wobbleDepth = get(ParameterIDs::wobbleDepth);
+    values.wobbleRateHz = get(ParameterIDs::wobbleRateHz);
+    values.wobbleSync = get(ParameterIDs::wobbleSync);
+    values.wobbleFlutter = get(ParameterIDs::wobbleFlutter);
+    values.wobbleDrift = get(ParameterIDs::wobbleDrift);
+    values.wobbleJitter = get(ParameterIDs::wobbleJitter);
+    values.wobbleStereoLink = get(ParameterIDs::wobbleStereoLink);
+    values.wobbleMono = get(ParameterIDs::wobbleMono);
+    values.wobbleQuality = get(ParameterIDs::wobbleQuality);
+
+    values.distortOn = get(ParameterIDs::distortOn);
+    values.distortType = get(ParameterIDs::distortType);
+    values.distortDrive = get(ParameterIDs::distortDrive);
+    values.distortTone = get(ParameterIDs::distortTone);
+    values.distortPrePost = get(ParameterIDs::distortPrePost);
+    values.distortOversampling = get(ParameterIDs::distortOversampling);
+
+    values.digitalOn = get(ParameterIDs::digitalOn);
+    values.digitalBits = get(ParameterIDs::digitalBits);
+    values.digitalSR = get(ParameterIDs::digitalSR);
+    values.digitalJitter = get(ParameterIDs::digitalJitter);
+    values.digitalAA = get(ParameterIDs::digitalAA);
+    values.digitalSRMode = get(ParameterIDs::digitalSRMode);
+
+    values.spaceOn = get(ParameterIDs::spaceOn);
+    values.spaceMix = get(ParameterIDs::spaceMix);
+    values.spaceTime = get(ParameterIDs::spaceTime);
+    values.spaceTone = get(ParameterIDs::spaceTone);
+    values.spacePreDelayMs = get(ParameterIDs::spacePreDelayMs);
+    values.spaceCheapo = get(ParameterIDs::spaceCheapo);
+
+    values.magOn = get(ParameterIDs::magOn);
+    values.magComp = get(ParameterIDs::magComp);
+    values.magSat = get(ParameterIDs::magSat);
+    values.magHeadBumpHz = get(ParameterIDs::magHeadBumpHz);
+    values.magCrosstalk = get(ParameterIDs::magCrosstalk);
+    values.magWear = get(ParameterIDs::magWear);
+    values.magSatMode = get(ParameterIDs::magSatMode);
+    values.magHysteresisQuality = get(ParameterIDs::magHysteresisQuality);
+}
+
+void ParameterCache::fill(ParamSnapshot& snapshot) const noexcept
+{
+    load(values.inGain, snapshot.inGain);
+    load(values.outGain, snapshot.outGain);
+    load(values.mix, snapshot.mix);
+    load(values.macroReallyCheap, snapshot.macroReallyCheap);
+    load(values.bypass, snapshot.bypass);
+    load(values.chainOversampling, snapshot.chainOversampling);
+
+    load(values.noiseOn, snapshot.noiseOn);
+    load(values.noiseType, snapshot.noiseType);
+    load(values.noiseLevel, snapshot.noiseLevel);
+    load(values.noiseAge, snapshot.noiseAge);
+    load(values.noiseFlutterGate, snapshot.noiseFlutterGate);
+    load(values.noiseWidth, snapshot.noiseWidth);
+    load(values.noisePlacement, snapshot.noisePlacement);
+
+    load(values.wobbleOn, snapshot.wobbleOn);
+    load(values.wobbleDepth, snapshot.wobbleDepth);
+    load(values.wobbleRateHz, snapshot.wobbleRateHz);
+    load(values.wobbleSync, snapshot.wobbleSync);
+    load(values.wobbleFlutter, snapshot.wobbleFlutter);
+    load(values.wobbleDrift, snapshot.wobbleDrift);
+    load(values.wobbleJitter, snapshot.wobbleJitter);
+    load(values.wobbleStereoLink, snapshot.wobbleStereoLink);
+    load(values.wobbleMono, snapshot.wobbleMono);
+    load(values.wobbleQuality, snapshot.wobbleQuality);
+
+    load(values.distortOn, snapshot.distortOn);
+    load(values.distortType, snapshot.distortType);
+    load(values.distortDrive, snapshot.distortDrive);
+    load(values.distortTone, snapshot.distortTone);
+    load(values.distortPrePost, snapshot.distortPrePost);
+    load(values.distortOversampling, snapshot.distortOversampling);
+
+    load(values.digitalOn, snapshot.digitalOn);
+    load(values.digitalBits, snapshot.digitalBits);
+    load(values.digitalSR, snapshot.digitalSR);
+    load(values.digitalJitter, snapshot.digitalJitter);
+    load(values.digitalAA, snapshot.digitalAA);
+    load(values.digitalSRMode, snapshot.digitalSRMode);
+
+    load(values.spaceOn, snapshot.spaceOn);
+    load(values.spaceMix, snapshot.spaceMix);
+    load(values.spaceTime, snapshot.spaceTime);
+    load(values.spaceTone, snapshot.spaceTone);
+    load(values.spacePreDelayMs, snapshot.spacePreDelayMs);
+    load(values.spaceCheapo, snapshot.spaceCheapo);
+
+    load(values.magOn, snapshot.magOn);
+    load(values.magComp, snapshot.magComp);
+    load(values.magSat, snapshot.magSat);
+    load(values.magHeadBumpHz, snapshot.magHeadBumpHz);
+    load(values.magCrosstalk, snapshot.magCrosstalk);
+    load(values.magWear, snapshot.magWear);
+    load(values.magSatMode, snapshot.magSatMode);
+    load(values.magHysteresisQuality, snapshot.magHysteresisQuality);
+}
+
+}
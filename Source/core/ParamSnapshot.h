@@ -0,0 +1,155 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "Params.h"
+
+namespace ReallyCheap
+{
+
+/**
+ * Plain copy of every parameter value, taken once per processBlock.
+ *
+ * Modules read their settings from here instead of looking parameters up by
+ * ID in the APVTS, so they can also be driven without one (tests, renderer).
+ * A default-constructed snapshot holds the factory defaults.
+ */
+struct ParamSnapshot
+{
+    float inGain = ParameterDefaults::inGain;
+    float outGain = ParameterDefaults::outGain;
+    float mix = ParameterDefaults::mix;
+    float macroReallyCheap = ParameterDefaults::macroReallyCheap;
+    bool bypass = ParameterDefaults::bypass;
+    int chainOversampling = ParameterDefaults::chainOversampling;
+
+    bool noiseOn = ParameterDefaults::noiseOn;
+    int noiseType = ParameterDefaults::noiseType;
+    float noiseLevel = ParameterDefaults::noiseLevel;
+    float noiseAge = ParameterDefaults::noiseAge;
+    float noiseFlutterGate = ParameterDefaults::noiseFlutterGate;
+    float noiseWidth = ParameterDefaults::noiseWidth;
+    int noisePlacement = ParameterDefaults::noisePlacement;
+
+    bool wobbleOn = ParameterDefaults::wobbleOn;
+    float wobbleDepth = ParameterDefaults::wobbleDepth;
+    float wobbleRateHz = ParameterDefaults::wobbleRateHz;
+    bool wobbleSync = ParameterDefaults::wobbleSync;
+    float wobbleFlutter = ParameterDefaults::wobbleFlutter;
+    float wobbleDrift = ParameterDefaults::wobbleDrift;
+    float wobbleJitter = ParameterDefaults::wobbleJitter;
+    float wobbleStereoLink = ParameterDefaults::wobbleStereoLink;
+    bool wobbleMono = ParameterDefaults::wobbleMono;
+    int wobbleQuality = ParameterDefaults::wobbleQuality;
+
+    bool distortOn = ParameterDefaults::distortOn;
+    int distortType = ParameterDefaults::distortType;
+    float distortDrive = ParameterDefaults::distortDrive;
+    float distortTone = ParameterDefaults::distortTone;
+    int distortPrePost = ParameterDefaults::distortPrePost;
+    int distortOversampling = ParameterDefaults::distortOversampling;
+
+    bool digitalOn = ParameterDefaults::digitalOn;
+    int digitalBits = ParameterDefaults::digitalBits;
+    float digitalSR = ParameterDefaults::digitalSR;
+    float digitalJitter = ParameterDefaults::digitalJitter;
+    bool digitalAA = ParameterDefaults::digitalAA;
+    int digitalSRMode = ParameterDefaults::digitalSRMode;
+
+    bool spaceOn = ParameterDefaults::spaceOn;
+    float spaceMix = ParameterDefaults::spaceMix;
+    float spaceTime = ParameterDefaults::spaceTime;
+    float spaceTone = ParameterDefaults::spaceTone;
+    float spacePreDelayMs = ParameterDefaults::spacePreDelayMs;
+    float spaceCheapo = ParameterDefaults::spaceCheapo;
+
+    bool magOn = ParameterDefaults::magOn;
+    float magComp = ParameterDefaults::magComp;
+    float magSat = ParameterDefaults::magSat;
+    float magHeadBumpHz = ParameterDefaults::magHeadBumpHz;
+    float magCrosstalk = ParameterDefaults::magCrosstalk;
+    float magWear = ParameterDefaults::magWear;
+    int magSatMode = ParameterDefaults::magSatMode;
+    int magHysteresisQuality = ParameterDefaults::magHysteresisQuality;
+};
+
+/**
+ * Resolves every parameter ID to its atomic value once, up front, so that
+ * filling a ParamSnapshot on the audio thread is just a series of loads.
+ */
+class ParameterCache
+{
+public:
+    ParameterCache() = default;
+
+    // Message thread, after the APVTS has been constructed
+    void attach(juce::AudioProcessorValueTreeState& apvts);
+
+    // Audio thread; parameters that were not found keep their current value
+    void fill(ParamSnapshot& snapshot) const noexcept;
+
+private:
+    struct Values
+    {
+        std::atomic<float>* inGain = nullptr;
+        std::atomic<float>* outGain = nullptr;
+        std::atomic<float>* mix = nullptr;
+        std::atomic<float>* macroReallyCheap = nullptr;
+        std::atomic<float>* bypass = nullptr;
+        std::atomic<float>* chainOversampling = nullptr;
+
+        std::atomic<float>* noiseOn = nullptr;
+        std::atomic<float>* noiseType = nullptr;
+        std::atomic<float>* noiseLevel = nullptr;
+        std::atomic<float>* noiseAge = nullptr;
+        std::atomic<float>* noiseFlutterGate = nullptr;
+        std::atomic<float>* noiseWidth = nullptr;
+        std::atomic<float>* noisePlacement = nullptr;
+
+        std::atomic<float>* wobbleOn = nullptr;
+        std::atomic<float>* wobbleDepth = nullptr;
+        std::atomic<float>* wobbleRateHz = nullptr;
+        std::atomic<float>* wobbleSync = nullptr;
+        std::atomic<float>* wobbleFlutter = nullptr;
+        std::atomic<float>* wobbleDrift = nullptr;
+        std::atomic<float>* wobbleJitter = nullptr;
+        std::atomic<float>* wobbleStereoLink = nullptr;
+        std::atomic<float>* wobbleMono = nullptr;
+        std::atomic<float>* wobbleQuality = nullptr;
+
+        std::atomic<float>* distortOn = nullptr;
+        std::atomic<float>* distortType = nullptr;
+        std::atomic<float>* distortDrive = nullptr;
+        std::atomic<float>* distortTone = nullptr;
+        std::atomic<float>* distortPrePost = nullptr;
+        std::atomic<float>* distortOversampling = nullptr;
+
+        std::atomic<float>* digitalOn = nullptr;
+        std::atomic<float>* digitalBits = nullptr;
+        std::atomic<float>* digitalSR = nullptr;
+        std::atomic<float>* digitalJitter = nullptr;
+        std::atomic<float>* digitalAA = nullptr;
+        std::atomic<float>* digitalSRMode = nullptr;
+
+        std::atomic<float>* spaceOn = nullptr;
+        std::atomic<float>* spaceMix = nullptr;
+        std::atomic<float>* spaceTime = nullptr;
+        std::atomic<float>* spaceTone = nullptr;
+        std::atomic<float>* spacePreDelayMs = nullptr;
+        std::atomic<float>* spaceCheapo = nullptr;
+
+        std::atomic<float>* magOn = nullptr;
+        std::atomic<float>* magComp = nullptr;
+        std::atomic<float>* magSat = nullptr;
+        std::atomic<float>* magHeadBumpHz = nullptr;
+        std::atomic<float>* magCrosstalk = nullptr;
+        std::atomic<float>* magWear = nullptr;
+        std::atomic<float>* magSatMode = nullptr;
+        std::atomic<float>* magHysteresisQuality = nullptr;
+    };
+
+    Values values;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParameterCache)
+};
+
+}
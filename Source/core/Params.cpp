@@ -28,6 +28,11 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterHelper::createParam
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::bypass, "Bypass", ParameterDefaults::bypass));
     
+    // Runs Crunch, Digital and Magnetic together at a higher rate; changing it re-prepares the chain
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::chainOversampling, "Chain Oversampling", getChainOversamplingChoices(),
+        ParameterDefaults::chainOversampling));
+    
     
     // Noise Parameters
     layout.add(std::make_unique<juce::AudioParameterBool>(
@@ -89,6 +94,9 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterHelper::createParam
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::wobbleMono, "Bend Mono", ParameterDefaults::wobbleMono));
     
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::wobbleQuality, "Bend Quality", getWobbleQualityChoices(), ParameterDefaults::wobbleQuality));
+    
     // Distort Parameters
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::distortOn, "Crunch On", ParameterDefaults::distortOn));
@@ -109,6 +117,10 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterHelper::createParam
     layout.add(std::make_unique<juce::AudioParameterChoice>(
         ParameterIDs::distortPrePost, "Crunch Pre/Post", getPlacementChoices(), ParameterDefaults::distortPrePost));
     
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::distortOversampling, "Crunch Oversampling", getDistortOversamplingChoices(),
+        ParameterDefaults::distortOversampling));
+    
     // Digital Parameters
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::digitalOn, "Bitcrush On", ParameterDefaults::digitalOn));
@@ -127,6 +139,9 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterHelper::createParam
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::digitalAA, "Bitcrush Anti-Aliasing", ParameterDefaults::digitalAA));
     
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::digitalSRMode, "Bitcrush Hold", getDigitalSRModeChoices(), ParameterDefaults::digitalSRMode));
+    
     // Space Parameters
     layout.add(std::make_unique<juce::AudioParameterBool>(
         ParameterIDs::spaceOn, "Verb On", ParameterDefaults::spaceOn));
@@ -176,6 +191,13 @@ juce::AudioProcessorValueTreeState::ParameterLayout ParameterHelper::createParam
         ParameterIDs::magWear, "Tape Aging",
         juce::NormalisableRange<float>(0.0f, 1.0f), ParameterDefaults::magWear));
     
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::magSatMode, "Tape Saturation Mode", getMagSatModeChoices(), ParameterDefaults::magSatMode));
+    
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        ParameterIDs::magHysteresisQuality, "Tape Hysteresis Quality", getMagHysteresisQualityChoices(),
+        ParameterDefaults::magHysteresisQuality));
+    
     return layout;
 }
 
@@ -12,6 +12,7 @@ struct ParameterIDs
     static constexpr const char* mix = "mix";
     static constexpr const char* macroReallyCheap = "macroReallyCheap";
     static constexpr const char* bypass = "bypass";
+    static constexpr const char* chainOversampling = "chainOversampling";
     
     static constexpr const char* noiseOn = "noiseOn";
     static constexpr const char* noiseType = "noiseType";
@@ -30,18 +31,21 @@ struct ParameterIDs
     static constexpr const char* wobbleJitter = "wobbleJitter";
     static constexpr const char* wobbleStereoLink = "wobbleStereoLink";
     static constexpr const char* wobbleMono = "wobbleMono";
+    static constexpr const char* wobbleQuality = "wobbleQuality";
     
     static constexpr const char* distortOn = "distortOn";
     static constexpr const char* distortType = "distortType";
     static constexpr const char* distortDrive = "distortDrive";
     static constexpr const char* distortTone = "distortTone";
     static constexpr const char* distortPrePost = "distortPrePost";
+    static constexpr const char* distortOversampling = "distortOversampling";
     
     static constexpr const char* digitalOn = "digitalOn";
     static constexpr const char* digitalBits = "digitalBits";
     static constexpr const char* digitalSR = "digitalSR";
     static constexpr const char* digitalJitter = "digitalJitter";
     static constexpr const char* digitalAA = "digitalAA";
+    static constexpr const char* digitalSRMode = "digitalSRMode";
     
     static constexpr const char* spaceOn = "spaceOn";
     static constexpr const char* spaceMix = "spaceMix";
@@ -56,6 +60,8 @@ struct ParameterIDs
     static constexpr const char* magHeadBumpHz = "magHeadBumpHz";
     static constexpr const char* magCrosstalk = "magCrosstalk";
     static constexpr const char* magWear = "magWear";
+    static constexpr const char* magSatMode = "magSatMode";
+    static constexpr const char* magHysteresisQuality = "magHysteresisQuality";
 };
 
 struct ParameterDefaults
@@ -65,6 +71,7 @@ struct ParameterDefaults
     static constexpr float mix = 0.5f;
     static constexpr float macroReallyCheap = 0.3f;
     static constexpr bool bypass = false;
+    static constexpr int chainOversampling = 0; // off
     
     static constexpr bool noiseOn = false;
     static constexpr int noiseType = 0; // vinyl
@@ -83,18 +90,21 @@ struct ParameterDefaults
     static constexpr float wobbleJitter = 0.1f;
     static constexpr float wobbleStereoLink = 0.7f;
     static constexpr bool wobbleMono = false;
+    static constexpr int wobbleQuality = 1; // hermite
     
     static constexpr bool distortOn = true;
     static constexpr int distortType = 0; // tape
     static constexpr float distortDrive = 4.0f;
     static constexpr float distortTone = 0.0f;
     static constexpr int distortPrePost = 1; // post
+    static constexpr int distortOversampling = 2; // 4x, which older sessions ran at
     
     static constexpr bool digitalOn = false;
     static constexpr int digitalBits = 12;
     static constexpr float digitalSR = 24000.0f;
     static constexpr float digitalJitter = 0.1f;
     static constexpr bool digitalAA = true;
+    static constexpr int digitalSRMode = 1; // band-limited
     
     static constexpr bool spaceOn = true;
     static constexpr float spaceMix = 0.18f;
@@ -109,6 +119,8 @@ struct ParameterDefaults
     static constexpr float magHeadBumpHz = 70.0f;
     static constexpr float magCrosstalk = 0.2f;
     static constexpr float magWear = 0.2f;
+    static constexpr int magSatMode = 0; // tanh
+    static constexpr int magHysteresisQuality = 0; // rk2
 };
 
 class ParameterHelper
@@ -124,6 +136,29 @@ public:
         return { "tape", "diode", "fold" };
     }
     
+    static juce::StringArray getDistortOversamplingChoices() {
+        return { "1x", "2x", "4x", "8x" };
+    }
+    
+    static juce::StringArray getChainOversamplingChoices() {
+        return { "off", "2x", "4x" };
+    }
+    
+    static juce::StringArray getWobbleQualityChoices() {
+        return { "linear", "hermite", "sinc" };
+    }
+    
+    static juce::StringArray getMagSatModeChoices() {
+        return { "tanh", "hysteresis" };
+    }
+    
+    static juce::StringArray getMagHysteresisQualityChoices() {
+        return { "rk2", "rk4", "nr4", "nr8" };
+    }
+    
+    static juce::StringArray getDigitalSRModeChoices() {
+        return { "naive", "bandLimited" };
+    }
     
     static juce::StringArray getPlacementChoices() {
         return { "pre", "post" };
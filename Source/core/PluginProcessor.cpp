@@ -16,10 +16,18 @@ ReallyCheapTwentyAudioProcessor::ReallyCheapTwentyAudioProcessor()
     , valueTreeState(*this, nullptr, "Parameters", ReallyCheap::ParameterHelper::createParameterLayout())
     , presetManager(valueTreeState)
 {
-    inGainParam = valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::inGain);
-    outGainParam = valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::outGain);
-    mixParam = valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::mix);
-    bypassParam = valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::bypass);
+    wobble.setScratchArena(scratchArena);
+    digital.setScratchArena(scratchArena);
+    magnetic.setScratchArena(scratchArena);
+    noise.setScratchArena(scratchArena);
+    space.setScratchArena(scratchArena);
+    
+    wobble.setBlockRandom(blockRandom);
+    digital.setBlockRandom(blockRandom);
+    magnetic.setBlockRandom(blockRandom);
+    
+    parameterCache.attach(valueTreeState);
+    chainOversamplingValue = valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::chainOversampling);
     
     // Initialize with embedded assets (full functionality restored)
     try
@@ -37,10 +45,13 @@ ReallyCheapTwentyAudioProcessor::ReallyCheapTwentyAudioProcessor()
     {
         DBG("Exception during plugin processor initialization - continuing");
     }
+    
+    startTimerHz(10);
 }
 
 ReallyCheapTwentyAudioProcessor::~ReallyCheapTwentyAudioProcessor()
 {
+    stopTimer();
 }
 
 const juce::String ReallyCheapTwentyAudioProcessor::getName() const
@@ -77,7 +88,7 @@ bool ReallyCheapTwentyAudioProcessor::isMidiEffect() const
 
 double ReallyCheapTwentyAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return tailLengthSeconds.load();
 }
 
 int ReallyCheapTwentyAudioProcessor::getNumPrograms()
@@ -119,30 +130,90 @@ void ReallyCheapTwentyAudioProcessor::prepareToPlay(double sampleRate, int sampl
     outGainSmoothed.reset(sampleRate, 0.02);
     mixSmoothed.reset(sampleRate, 0.03);
     
-    inGainSmoothed.setCurrentAndTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(*inGainParam));
-    outGainSmoothed.setCurrentAndTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(*outGainParam));
-    mixSmoothed.setCurrentAndTargetValue(*mixParam);
+    parameterCache.fill(params);
+    inGainSmoothed.setCurrentAndTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(params.inGain));
+    outGainSmoothed.setCurrentAndTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(params.outGain));
+    mixSmoothed.setCurrentAndTargetValue(params.mix);
+    
+    maxBlockSize = samplesPerBlock;
+    preparedSampleRate = sampleRate;
     
     macroController.prepare(sampleRate, samplesPerBlock);
     
-    distort.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
+    // Stereo features (crosstalk, noise width, wobble link, reverb width) act on speaker pairs
+    channelPairs.setFromChannelSet(getChannelLayoutOfBus(true, 0));
+    wobble.setChannelPairs(channelPairs);
+    magnetic.setChannelPairs(channelPairs);
+    noise.setChannelPairs(channelPairs);
+    space.setChannelPairs(channelPairs);
+    
+    prepareChain(sampleRate, samplesPerBlock);
     wobble.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
-    digital.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
-    magnetic.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
     noise.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
     space.prepare(sampleRate, samplesPerBlock, getTotalNumInputChannels());
+    
+    // Digital and Magnetic have no long tails, but give their filters and envelopes time to settle
+    chainTail.prepare(static_cast<int>(std::ceil(0.05 * sampleRate)));
+    updateTailLength();
+    updateLatency();
+    reportLatency();
+}
+
+void ReallyCheapTwentyAudioProcessor::prepareChain(double sampleRate, int samplesPerBlock)
+{
+    chainFactor = getRequestedChainFactor();
+    
+    // Modules inside the chain take their scratch buffers at the oversampled block size
+    const int chainBlockSize = samplesPerBlock * chainFactor;
+    const double chainSampleRate = sampleRate * chainFactor;
+    scratchArena.prepare(juce::jmax(2, getTotalNumInputChannels(), getTotalNumOutputChannels()),
+                         chainBlockSize, numScratchBuffers);
+    
+    distort.setChainOversampling(chainFactor);
+    magnetic.setChainOversampling(chainFactor);
+    
+    distort.prepare(chainSampleRate, chainBlockSize, getTotalNumInputChannels());
+    digital.prepare(chainSampleRate, chainBlockSize, getTotalNumInputChannels());
+    magnetic.prepare(chainSampleRate, chainBlockSize, getTotalNumInputChannels());
+    
+    distortDomain.prepare(getTotalNumInputChannels(), samplesPerBlock, chainFactor);
+    chainDomain.prepare(getTotalNumInputChannels(), samplesPerBlock, chainFactor);
+}
+
+int ReallyCheapTwentyAudioProcessor::getRequestedChainFactor() const noexcept
+{
+    // off, 2x, 4x
+    const int choice = chainOversamplingValue != nullptr ? juce::roundToInt(chainOversamplingValue->load()) : 0;
+    return 1 << juce::jlimit(0, 2, choice);
+}
+
+void ReallyCheapTwentyAudioProcessor::timerCallback()
+{
+    if (preparedSampleRate > 0.0 && getRequestedChainFactor() != chainFactor)
+    {
+        // Rebuilding allocates, so the audio thread is held off until the modules are ready
+        suspendProcessing(true);
+        prepareChain(preparedSampleRate, maxBlockSize);
+        updateLatency();
+        suspendProcessing(false);
+    }
+    
+    reportLatency();
 }
 
 void ReallyCheapTwentyAudioProcessor::releaseResources()
 {
     macroController.reset();
     
+    distortDomain.reset();
+    chainDomain.reset();
     distort.reset();
     wobble.reset();
     digital.reset();
     magnetic.reset();
     noise.reset();
     space.reset();
+    chainTail.wake();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -152,8 +223,9 @@ bool ReallyCheapTwentyAudioProcessor::isBusesLayoutSupported(const BusesLayout&
     juce::ignoreUnused(layouts);
     return true;
 #else
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-        && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout up to 16 channels: mono, stereo, surround beds and discrete stems
+    const auto& mainOutput = layouts.getMainOutputChannelSet();
+    if (mainOutput.isDisabled() || mainOutput.size() > ReallyCheap::ChannelPairs::maxChannels)
         return false;
 
 #if ! JucePlugin_IsSynth
@@ -171,14 +243,7 @@ void ReallyCheapTwentyAudioProcessor::processBlock(juce::AudioBuffer<float>& buf
     juce::ignoreUnused(midiMessages);
 
     juce::ScopedNoDenormals noDenormals;
-    
-    // Basic debug output to verify debug messages are working
-    static int processBlockCount = 0;
-    processBlockCount++;
-    if (processBlockCount < 5)
-    {
-        DBG("*** PROCESS BLOCK #" << processBlockCount << " - Plugin is running! ***");
-    }
+    ReallyCheap::AllocationCounter::ScopedAudioThreadCheck allocationCheck(audioThreadAllocations);
     
     const auto totalNumInputChannels = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -187,115 +252,302 @@ void ReallyCheapTwentyAudioProcessor::processBlock(juce::AudioBuffer<float>& buf
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, numSamples);
 
+    // Not prepared yet (or prepareToPlay rejected the host's settings)
+    if (maxBlockSize <= 0 || scratchArena.getCapacity() == 0)
+        return;
+
+    // One snapshot per host block; every sub-block and module sees the same values
+    parameterCache.fill(params);
+    wobble.setNonRealtime(isNonRealtime());
+
+    // Scratch storage is sized for the block size promised in prepareToPlay,
+    // so split anything larger into sub-blocks that reference the host buffer
+    for (int startSample = 0; startSample < numSamples; startSample += maxBlockSize)
+    {
+        const int subBlockSamples = juce::jmin(maxBlockSize, numSamples - startSample);
+        juce::AudioBuffer<float> subBlock(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                          startSample, subBlockSamples);
+        processSubBlock(subBlock);
+    }
+    
+    // Worked out once the modules have taken this block's settings
+    updateTailLength();
+    updateLatency();
+}
+
+void ReallyCheapTwentyAudioProcessor::updateTailLength() noexcept
+{
+    double seconds = 0.0;
+    
+    if (params.distortOn)
+        seconds += distort.getTailLengthSeconds();
+    if (params.wobbleOn)
+        seconds += wobble.getTailLengthSeconds();
+    if (params.spaceOn)
+        seconds += space.getTailLengthSeconds();
+    
+    tailLengthSeconds.store(seconds);
+}
+
+void ReallyCheapTwentyAudioProcessor::updateLatency() noexcept
+{
+    // Only modules in the signal path add latency. This runs on the audio thread, where hosts
+    // do not expect setLatencySamples(), so the total is only recorded here.
+    int latency = 0;
+    
+    // Distort reports none of its own inside a shared chain, where the domains add theirs
+    if (params.distortOn)
+        latency += distort.getLatencySamples();
+    if (params.distortOn && params.distortPrePost == 0)
+        latency += distortDomain.getLatencySamples();
+    if (isChainActive())
+        latency += chainDomain.getLatencySamples();
+    if (params.magOn && params.magSatMode == 1)
+        latency += magnetic.getLatencySamples();
+    if (params.spaceOn)
+        latency += space.getLatencySamples();
+    
+    processingLatency.store(latency);
+}
+
+void ReallyCheapTwentyAudioProcessor::reportLatency()
+{
+    const int latency = processingLatency.load();
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+}
+
+bool ReallyCheapTwentyAudioProcessor::isChainActive() const noexcept
+{
+    return (params.distortOn && params.distortPrePost == 1) || params.digitalOn || params.magOn;
+}
+
+void ReallyCheapTwentyAudioProcessor::processSubBlock(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const auto totalNumInputChannels = getTotalNumInputChannels();
+    const auto numSamples = buffer.getNumSamples();
+
     // Bypass removed - DAWs handle this natively
 
     // Update macro controller before processing any modules
-    macroController.tick(valueTreeState);
+    macroController.tick(params);
 
-    inGainSmoothed.setTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(*inGainParam));
-    outGainSmoothed.setTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(*outGainParam));
-    mixSmoothed.setTargetValue(*mixParam);
+    inGainSmoothed.setTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(params.inGain));
+    outGainSmoothed.setTargetValue(ReallyCheap::ParameterHelper::decibelToLinear(params.outGain));
+    mixSmoothed.setTargetValue(params.mix);
 
-    // Apply input gain
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
+    // Judge silence after the input gain, so a quiet signal boosted into range still counts
+    const float maxInGain = juce::jmax(inGainSmoothed.getCurrentValue(), inGainSmoothed.getTargetValue());
+    const bool inputSilent = ReallyCheap::TailTracker::isSilent(buffer, ReallyCheap::TailTracker::silenceThreshold / maxInGain);
+
+    if (inputSilent && ! params.noiseOn && chainTail.isSleeping())
     {
-        auto* channelData = buffer.getWritePointer(channel);
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            const float inGain = inGainSmoothed.getNextValue();
-            channelData[sample] *= inGain;
-        }
+        // Nothing to hear: skip the whole chain. The smoothers jump to their targets
+        // since there is no signal for a ramp to act on.
+        inGainSmoothed.setCurrentAndTargetValue(inGainSmoothed.getTargetValue());
+        outGainSmoothed.setCurrentAndTargetValue(outGainSmoothed.getTargetValue());
+        mixSmoothed.setCurrentAndTargetValue(mixSmoothed.getTargetValue());
+        buffer.clear();
+        return;
     }
 
-    // Store dry signal for mix
-    juce::AudioBuffer<float> dryBuffer;
-    dryBuffer.makeCopyOf(buffer);
+    // Input gain and dry capture (scratch storage, rewound every sub-block)
+    scratchArena.rewind();
+    auto dryBuffer = scratchArena.getBuffer(buffer.getNumChannels(), numSamples);
+    if (dryBuffer.getNumChannels() != buffer.getNumChannels())
+        return;
+
+    applyInputStage(buffer, dryBuffer, totalNumInputChannels);
 
     // Check noise placement (pre or post effects)
-    const int noisePlacement = static_cast<int>(*valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::noisePlacement));
+    const int noisePlacement = params.noisePlacement;
     
     
     // Apply pre-effect noise if configured
     if (noisePlacement == 0) // 0 = pre
     {
-        noise.process(buffer, getPlayHead(), valueTreeState, macroController);
+        noise.process(buffer, getPlayHead(), params, macroController);
     }
     
     // Check distort placement setting
-    const int distortPlacement = static_cast<int>(*valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::distortPrePost));
+    const int distortPlacement = params.distortPrePost;
     
     // Apply distortion PRE if configured
     if (distortPlacement == 0) // 0 = pre (before wobble)
     {
-        distort.process(buffer, getPlayHead(), valueTreeState, macroController);
+        distortDomain.process(buffer, params.distortOn, [this] (juce::AudioBuffer<float>& block)
+        {
+            distort.process(block, getPlayHead(), params, macroController);
+        });
     }
-    
-    // Process wobble (wow/flutter) first for vintage character
-    wobble.process(buffer, getPlayHead(), valueTreeState, macroController);
-
-    // Apply distortion POST if configured  
-    if (distortPlacement == 1) // 1 = post (after wobble, default)
+    else
     {
-        distort.process(buffer, getPlayHead(), valueTreeState, macroController);
+        // Idle while Crunch sits post, so its dry delay stops with the latency it reported
+        distortDomain.process(buffer, false, [] (juce::AudioBuffer<float>&) {});
     }
     
-    // Process digital degradation
-    static int mainProcessorCallCount = 0;
-    mainProcessorCallCount++;
-    if (mainProcessorCallCount < 10)
+    // Process wobble (wow/flutter) first for vintage character
+    wobble.process(buffer, getPlayHead(), params, macroController);
+
+    // Everything nonlinear between Wobble and Noise shares one up- and downsample
+    // when Chain Oversampling is on; otherwise this runs straight on buffer
+    chainDomain.process(buffer, isChainActive(), [this, distortPlacement] (juce::AudioBuffer<float>& block)
     {
-        DBG("=== MAIN PROCESSOR DEBUG #" << mainProcessorCallCount << " ===");
-        DBG("About to call digital.process() - buffer has " << buffer.getNumSamples() << 
-            " samples, " << buffer.getNumChannels() << " channels");
+        // Apply distortion POST if configured
+        if (distortPlacement == 1) // 1 = post (after wobble, default)
+        {
+            distort.process(block, getPlayHead(), params, macroController);
+        }
         
-        // Check digital module state
-        const bool digitalOn = *valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::digitalOn) > 0.5f;
-        const int digitalBits = static_cast<int>(*valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::digitalBits));
-        const float digitalSR = *valueTreeState.getRawParameterValue(ReallyCheap::ParameterIDs::digitalSR);
+        // Process digital degradation
+        digital.process(block, getPlayHead(), params, macroController);
         
-        DBG("Digital params before call - On: " << digitalOn << ", Bits: " << digitalBits << ", SR: " << digitalSR);
-    }
-    
-    digital.process(buffer, getPlayHead(), valueTreeState, macroController);
-    
-    if (mainProcessorCallCount < 10)
-    {
-        DBG("Digital.process() completed");
-    }
-    
-    // Process magnetic tape characteristics
-    magnetic.process(buffer, getPlayHead(), valueTreeState, macroController);
+        // Process magnetic tape characteristics
+        magnetic.process(block, getPlayHead(), params, macroController);
+    });
     
     // Apply post-effect noise if configured
     if (noisePlacement == 1) // 1 = post
     {
-        noise.process(buffer, getPlayHead(), valueTreeState, macroController);
+        noise.process(buffer, getPlayHead(), params, macroController);
     }
     
     // Apply space (reverb) at the end of the chain
-    space.process(buffer, getPlayHead(), valueTreeState, macroController);
+    space.process(buffer, getPlayHead(), params, macroController);
+
+    // Delay the dry copy by the latency the chain added so the mix does not comb-filter
+    if (params.distortOn)
+        distort.alignDryPath(dryBuffer);
+    if (distortPlacement == 0)
+        distortDomain.alignDryPath(dryBuffer);
+    chainDomain.alignDryPath(dryBuffer);
+    magnetic.alignDryPath(dryBuffer);
+
+    // Mix, output gain and safety clip
+    applyOutputStage(buffer, dryBuffer, totalNumInputChannels);
+
+    // The Noise bed keeps the chain awake; otherwise sleep once every tail has finished
+    const bool tailsFinished = (! params.distortOn || distort.isAsleep())
+                            && (! params.wobbleOn || wobble.isAsleep())
+                            && (! params.spaceOn || space.isAsleep());
+
+    chainTail.addBlock(inputSilent && ! params.noiseOn && tailsFinished
+                           && ReallyCheap::TailTracker::isSilent(buffer),
+                       numSamples);
+}
+
+bool ReallyCheapTwentyAudioProcessor::fillRamp(juce::SmoothedValue<float>& smoother, float* ramp, int numSamples) noexcept
+{
+    if (! smoother.isSmoothing())
+        return false;
+
+    for (int sample = 0; sample < numSamples; ++sample)
+        ramp[sample] = smoother.getNextValue();
+
+    return true;
+}
+
+void ReallyCheapTwentyAudioProcessor::applyInputStage(juce::AudioBuffer<float>& buffer,
+                                                      juce::AudioBuffer<float>& dryBuffer,
+                                                      int numGainChannels) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    ReallyCheap::ScratchArena::Scope scope(scratchArena);
+
+    // One ramp per block, shared by every channel
+    float* gainRamp = inGainSmoothed.isSmoothing() ? scratchArena.getFloats(numSamples) : nullptr;
+    const bool ramping = gainRamp != nullptr && fillRamp(inGainSmoothed, gainRamp, numSamples);
+    if (! ramping)
+        inGainSmoothed.setCurrentAndTargetValue(inGainSmoothed.getTargetValue());
+
+    const float gain = inGainSmoothed.getTargetValue();
+
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+    {
+        auto* channelData = buffer.getWritePointer(channel);
+        auto* dryData = dryBuffer.getWritePointer(channel);
+
+        // Write the gained signal to the dry copy, then copy it back as the wet input
+        if (channel >= numGainChannels || (! ramping && gain == 1.0f))
+        {
+            juce::FloatVectorOperations::copy(dryData, channelData, numSamples);
+            continue;
+        }
+
+        if (ramping)
+            juce::FloatVectorOperations::multiply(dryData, channelData, gainRamp, numSamples);
+        else
+            juce::FloatVectorOperations::multiply(dryData, channelData, gain, numSamples);
+
+        juce::FloatVectorOperations::copy(channelData, dryData, numSamples);
+    }
+}
+
+void ReallyCheapTwentyAudioProcessor::applyOutputStage(juce::AudioBuffer<float>& buffer,
+                                                       const juce::AudioBuffer<float>& dryBuffer,
+                                                       int numGainChannels) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = juce::jmin(numGainChannels, buffer.getNumChannels());
+    ReallyCheap::ScratchArena::Scope scope(scratchArena);
+
+    // out = (wet * mix + dry * (1 - mix)) * outGain, folded into one wet and one dry gain
+    float* wetGains = nullptr;
+    float* dryGains = nullptr;
+
+    if (mixSmoothed.isSmoothing() || outGainSmoothed.isSmoothing())
+    {
+        wetGains = scratchArena.getFloats(numSamples);
+        dryGains = scratchArena.getFloats(numSamples);
+    }
+
+    if (wetGains != nullptr && dryGains != nullptr)
+    {
+        if (! fillRamp(mixSmoothed, wetGains, numSamples))
+            juce::FloatVectorOperations::fill(wetGains, mixSmoothed.getTargetValue(), numSamples);
+        if (! fillRamp(outGainSmoothed, dryGains, numSamples))
+            juce::FloatVectorOperations::fill(dryGains, outGainSmoothed.getTargetValue(), numSamples);
+
+        juce::FloatVectorOperations::multiply(wetGains, dryGains, numSamples);  // mix * gain
+        juce::FloatVectorOperations::subtract(dryGains, wetGains, numSamples);  // (1 - mix) * gain
+    }
+    else
+    {
+        // Settled, or the arena ran dry: a constant gain is exact once the ramps are done
+        mixSmoothed.setCurrentAndTargetValue(mixSmoothed.getTargetValue());
+        outGainSmoothed.setCurrentAndTargetValue(outGainSmoothed.getTargetValue());
+        wetGains = dryGains = nullptr;
+    }
 
-    // Apply mix and output gain
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
+    const float mix = mixSmoothed.getTargetValue();
+    const float outGain = outGainSmoothed.getTargetValue();
+    const float wetGain = mix * outGain;
+    const float dryGain = outGain - wetGain;
+
+    for (int channel = 0; channel < numChannels; ++channel)
     {
         auto* wetData = buffer.getWritePointer(channel);
         auto* dryData = dryBuffer.getReadPointer(channel);
 
-        for (int sample = 0; sample < numSamples; ++sample)
+        if (wetGains != nullptr)
+        {
+            juce::FloatVectorOperations::multiply(wetData, wetGains, numSamples);
+            juce::FloatVectorOperations::addWithMultiply(wetData, dryData, dryGains, numSamples);
+        }
+        else
         {
-            const float mix = mixSmoothed.getNextValue();
-            const float outGain = outGainSmoothed.getNextValue();
-            
-            float outputSample = (wetData[sample] * mix) + (dryData[sample] * (1.0f - mix));
-            outputSample *= outGain;
-            
-            // EMERGENCY SAFETY LIMITER - prevent feedback damage
-            outputSample = juce::jlimit(-2.0f, 2.0f, outputSample);
-            if (!std::isfinite(outputSample))
-                outputSample = 0.0f;
-            
-            wetData[sample] = outputSample;
+            if (wetGain != 1.0f)
+                juce::FloatVectorOperations::multiply(wetData, wetGain, numSamples);
+            if (dryGain != 0.0f)
+                juce::FloatVectorOperations::addWithMultiply(wetData, dryData, dryGain, numSamples);
         }
+
+        // EMERGENCY SAFETY LIMITER - prevent feedback damage. NaNs go to silence first
+        // (branch-free, so it vectorises) since the SIMD clip would turn them into full scale.
+        for (int sample = 0; sample < numSamples; ++sample)
+            wetData[sample] = wetData[sample] == wetData[sample] ? wetData[sample] : 0.0f;
+
+        juce::FloatVectorOperations::clip(wetData, wetData, -2.0f, 2.0f, numSamples);
     }
 }
 
@@ -4,14 +4,22 @@
 #include "Params.h"
 #include "Presets.h"
 #include "MacroController.h"
+#include "ParamSnapshot.h"
+#include "ScratchArena.h"
+#include "BlockRandom.h"
+#include "AllocationCounter.h"
 #include "../dsp/Distort.h"
 #include "../dsp/Wobble.h"
 #include "../dsp/Digital.h"
 #include "../dsp/Magnetic.h"
 #include "../dsp/Noise.h"
 #include "../dsp/Space.h"
+#include "../dsp/shared/TailTracker.h"
+#include "../dsp/shared/ChannelPairs.h"
+#include "../dsp/shared/OversampledDomain.h"
 
-class ReallyCheapTwentyAudioProcessor : public juce::AudioProcessor
+class ReallyCheapTwentyAudioProcessor : public juce::AudioProcessor,
+                                        private juce::Timer
 {
 public:
     ReallyCheapTwentyAudioProcessor();
@@ -53,27 +61,86 @@ public:
     bool saveUserPreset(const juce::String& path);
     juce::StringArray getPresetList();
     ReallyCheap::PresetManager& getPresetManager() { return presetManager; }
+    
+    // Heap allocations seen inside processBlock so far (counted in debug builds of the renderer, 0 elsewhere)
+    juce::int64 getAudioThreadAllocationCount() const noexcept { return audioThreadAllocations.load(); }
+    
+    // Restarts every noise source from a fixed seed, so a render can be repeated exactly.
+    // Call before processing starts; instances are seeded randomly otherwise.
+    void setRandomSeed(juce::uint64 seed) noexcept { blockRandom.setSeed(seed); }
+    
+    // Latency the current settings add, as last worked out by processBlock; the host hears
+    // about changes to it from the message thread
+    int getProcessingLatencySamples() const noexcept { return processingLatency.load(); }
 
 private:
+    void processSubBlock(juce::AudioBuffer<float>& buffer) noexcept;
+    void updateTailLength() noexcept;
+    void updateLatency() noexcept;
+    void reportLatency();
+    
+    // Prepares the modules that can run oversampled, at the factor the Chain Oversampling
+    // parameter asks for, along with the scratch storage they draw on
+    void prepareChain(double sampleRate, int samplesPerBlock);
+    
+    // True while some module inside the shared oversampled chain is switched on
+    bool isChainActive() const noexcept;
+    int getRequestedChainFactor() const noexcept;
+    
+    // Watches Chain Oversampling on the message thread, where a new factor's buffers can be
+    // built, and passes latency changes on to the host
+    void timerCallback() override;
+    
+    // Vectorised gain stages either side of the chain; ramps are built once and shared across channels
+    void applyInputStage(juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& dryBuffer, int numGainChannels) noexcept;
+    void applyOutputStage(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>& dryBuffer, int numGainChannels) noexcept;
+    
+    // Fills ramp with the smoother's next values; false when it has settled and a constant will do
+    static bool fillRamp(juce::SmoothedValue<float>& smoother, float* ramp, int numSamples) noexcept;
+    
+    // Dry copy for the mix plus one module-scoped temporary; the spare holds the gain ramps
+    static constexpr int numScratchBuffers = 3;
+
     juce::AudioProcessorValueTreeState valueTreeState;
     ReallyCheap::PresetManager presetManager;
     ReallyCheap::MacroController macroController;
     
-    std::atomic<float>* inGainParam = nullptr;
-    std::atomic<float>* outGainParam = nullptr;
-    std::atomic<float>* mixParam = nullptr;
-    std::atomic<float>* bypassParam = nullptr;
+    // Parameter values are copied once per processBlock and handed to every module
+    ReallyCheap::ParameterCache parameterCache;
+    ReallyCheap::ParamSnapshot params;
     
     juce::SmoothedValue<float> inGainSmoothed;
     juce::SmoothedValue<float> outGainSmoothed;
     juce::SmoothedValue<float> mixSmoothed;
     
+    // Declared before the modules that keep a reference to them
+    ReallyCheap::ScratchArena scratchArena;
+    ReallyCheap::BlockRandom blockRandom;
+    int maxBlockSize = 0;
+    double preparedSampleRate = 0.0;
+    std::atomic<juce::int64> audioThreadAllocations { 0 };
+    
+    // Left/right pairing of the main bus, handed to the modules in prepareToPlay
+    ReallyCheap::ChannelPairs channelPairs;
+    
+    // Asleep once the input is silent and every module's tail has died away
+    ReallyCheap::TailTracker chainTail;
+    std::atomic<double> tailLengthSeconds { 0.0 };
+    std::atomic<int> processingLatency { 0 };
+    
     ReallyCheap::Distort distort;
     ReallyCheap::Wobble wobble;
     ReallyCheap::Digital digital;
     ReallyCheap::Magnetic magnetic;
     ReallyCheap::Noise noise;
     ReallyCheap::Space space;
+    
+    // Optional shared oversampling: one domain around Distort when it sits before Wobble,
+    // one from after Wobble to before Noise and Space. Both run at chainFactor.
+    std::atomic<float>* chainOversamplingValue = nullptr;
+    int chainFactor = 1;
+    ReallyCheap::OversampledDomain distortDomain;
+    ReallyCheap::OversampledDomain chainDomain;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReallyCheapTwentyAudioProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "ScratchArena.h"
+
+namespace ReallyCheap
+{
+
+void ScratchArena::prepare(int numChannels, int maxSamples, int numBuffers)
+{
+    jassert(numChannels <= maxChannels);
+
+    const auto perChannel = roundUp(static_cast<size_t>(juce::jmax(1, maxSamples)));
+    const auto required = perChannel * static_cast<size_t>(juce::jmax(1, numChannels))
+                                     * static_cast<size_t>(juce::jmax(1, numBuffers));
+
+    if (required != capacity)
+    {
+        storage.allocate(required + alignmentFloats, true);
+
+        const auto address = reinterpret_cast<uintptr_t>(storage.get());
+        const auto alignBytes = alignmentFloats * sizeof(float);
+        alignedStart = reinterpret_cast<float*>((address + alignBytes - 1) & ~(uintptr_t) (alignBytes - 1));
+        capacity = required;
+    }
+
+    used = 0;
+}
+
+void ScratchArena::release()
+{
+    storage.free();
+    alignedStart = nullptr;
+    capacity = 0;
+    used = 0;
+}
+
+float* ScratchArena::getFloats(int numFloats) noexcept
+{
+    const auto size = roundUp(static_cast<size_t>(juce::jmax(0, numFloats)));
+
+    if (used + size > capacity)
+    {
+        jassertfalse; // Arena sized too small in prepareToPlay
+        return nullptr;
+    }
+
+    auto* data = alignedStart + used;
+    used += size;
+    return data;
+}
+
+juce::AudioBuffer<float> ScratchArena::getBuffer(int numChannels, int numSamples) noexcept
+{
+    if (numChannels > maxChannels)
+    {
+        jassertfalse;
+        return {};
+    }
+
+    float* channelPointers[maxChannels] = {};
+    const auto mark = used;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        channelPointers[ch] = getFloats(numSamples);
+
+        if (channelPointers[ch] == nullptr)
+        {
+            used = mark;
+            return {};
+        }
+    }
+
+    return juce::AudioBuffer<float>(channelPointers, numChannels, numSamples);
+}
+
+}
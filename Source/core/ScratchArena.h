@@ -0,0 +1,70 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ReallyCheap
+{
+
+/**
+ * ScratchArena - per-instance bump allocator for temporary audio buffers
+ *
+ * Sized once from prepareToPlay (message thread). processBlock and the DSP
+ * modules borrow channel-major float storage from it instead of building
+ * juce::AudioBuffers on the heap, so the audio path never allocates.
+ *
+ * Storage handed out stays valid until the enclosing Scope ends or rewind()
+ * is called. Every allocation is 64-byte aligned.
+ */
+class ScratchArena
+{
+public:
+    // Keeps returned AudioBuffers inside JUCE's preallocated channel pointer space
+    static constexpr int maxChannels = 16;
+
+    ScratchArena() = default;
+
+    // Reserves room for numBuffers buffers of numChannels x maxSamples (message thread only)
+    void prepare(int numChannels, int maxSamples, int numBuffers);
+    void release();
+
+    // Returns a view onto uninitialised arena memory. If the arena is exhausted this
+    // asserts and returns a buffer with no channels, so callers must check for that.
+    juce::AudioBuffer<float> getBuffer(int numChannels, int numSamples) noexcept;
+    float* getFloats(int numFloats) noexcept;
+
+    void rewind() noexcept { used = 0; }
+
+    size_t getCapacity() const noexcept { return capacity; }
+    size_t getUsed() const noexcept { return used; }
+
+    // Returns everything allocated during its lifetime to the arena
+    class Scope
+    {
+    public:
+        explicit Scope(ScratchArena& arenaToUse) noexcept : arena(arenaToUse), mark(arenaToUse.used) {}
+        ~Scope() noexcept { arena.used = mark; }
+
+    private:
+        ScratchArena& arena;
+        const size_t mark;
+
+        JUCE_DECLARE_NON_COPYABLE(Scope)
+    };
+
+private:
+    static constexpr size_t alignmentFloats = 16; // 64 bytes
+
+    static size_t roundUp(size_t numFloats) noexcept
+    {
+        return (numFloats + alignmentFloats - 1) & ~(alignmentFloats - 1);
+    }
+
+    juce::HeapBlock<float> storage;
+    float* alignedStart = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScratchArena)
+};
+
+}
@@ -1,21 +1,30 @@
 #include "Digital.h"
 #include "../core/Params.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 
 namespace ReallyCheap
 {
 
 Digital::Digital()
 {
-    random.setSeedRandomly();
     hostSampleRate = 44100.0;
+    
+    // None of the crusher's curves depend on the sample rate, so they are sampled once here
+    mixToBitsTable.initialise([] (float mix) { return mixToBits(mix); }, 0.0f, 1.0f, 1024);
+    bitsToStepTable.initialise([] (float bits) { return stepSizeForBits(bits); }, 4.0f, 16.0f, 1024);
+    sineTable.initialise([] (float phase) { return std::sin(phase); },
+                         -juce::MathConstants<float>::pi, juce::MathConstants<float>::pi, 512);
+    saturationTable.initialise([] (float x) { return std::tanh(x * 0.7f) / 0.7f * 1.5f; }, -10.0f, 10.0f, 1024);
+    
+    // mixToBits(mix) <= 5 bits, solved for the mix
+    extremeLowpassMix = std::pow(11.0f / 12.0f, 1.25f);
 }
 
 void Digital::prepare(double sampleRate_, int blockSize, int numChannels_)
 {
     hostSampleRate = sampleRate_;
-    juce::ignoreUnused(blockSize);
-    
+
     // Ensure we have the right number of channels
     channels.resize(numChannels_);
     
@@ -29,6 +38,8 @@ void Digital::prepare(double sampleRate_, int blockSize, int numChannels_)
         // Initialize to "bypass" values to prevent pop on first enable
         channel.smoothedBits.setCurrentAndTargetValue(0.0f); // 0 mix = bypass
         channel.smoothedSampleRate.setCurrentAndTargetValue(0.0f); // 0 mix = bypass
+        channel.smoothedStrobeRate.reset(sampleRate_, rampLengthSeconds);
+        channel.blepCorrection.assign(static_cast<size_t>(juce::jmax(1, blockSize) + MinBlepTable::length), 0.0f);
         
         // Initialize phase accumulator
         channel.phase = 0.0;
@@ -48,6 +59,21 @@ void Digital::prepare(double sampleRate_, int blockSize, int numChannels_)
         channel.y1 = channel.y2 = 0.0f;
     }
     
+    // The anti-alias filter sits at a fixed fraction of the strobe rate
+    antiAliasTable.prepare(minStrobeRate, maxStrobeRate, [this] (float strobeRate)
+    {
+        const float cutoff = juce::jmin(strobeRate * 0.45f, static_cast<float>(hostSampleRate) * 0.499f);
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(hostSampleRate, cutoff, 0.707f); // Butterworth Q
+    });
+    
+    // Crusher one-poles only depend on the host rate
+    const float dt = 1.0f / static_cast<float>(hostSampleRate);
+    const auto rcFor = [] (float cutoffHz) { return 1.0f / (2.0f * juce::MathConstants<float>::pi * cutoffHz); };
+    
+    crossoverAlpha = rcFor(600.0f) / (rcFor(600.0f) + dt);   // Highpass: lower crossover to target more of the low end
+    hiDampAlpha = dt / (rcFor(8000.0f) + dt);                // Rolloff highs for analog warmth
+    extremeLowpassAlpha = dt / (rcFor(3500.0f) + dt);        // Lower cutoff for more analog feel
+    
     reset();
 }
 
@@ -70,12 +96,14 @@ void Digital::reset()
         // Reset smoothed parameters to bypass state to prevent pops
         channel.smoothedBits.setCurrentAndTargetValue(0.0f);
         channel.smoothedSampleRate.setCurrentAndTargetValue(0.0f);
+        channel.smoothedStrobeRate.setCurrentAndTargetValue(maxStrobeRate);
+        std::fill(channel.blepCorrection.begin(), channel.blepCorrection.end(), 0.0f);
     }
 }
 
 void Digital::process(juce::AudioBuffer<float>& buffer, 
                      juce::AudioPlayHead* playHead, 
-                     juce::AudioProcessorValueTreeState& apvts,
+                     const ParamSnapshot& params,
                      const MacroController& macro) noexcept
 {
     juce::ignoreUnused(playHead);
@@ -84,16 +112,17 @@ void Digital::process(juce::AudioBuffer<float>& buffer,
     const int bufferChannels = buffer.getNumChannels();
     
     // Get parameters
-    const bool digitalOn = *apvts.getRawParameterValue(ParameterIDs::digitalOn) > 0.5f;
+    const bool digitalOn = params.digitalOn;
     
     if (!digitalOn)
         return;
     
     // Get parameters - now treating them as MIX amounts (0-100%)
-    const int baseBitsParam = static_cast<int>(*apvts.getRawParameterValue(ParameterIDs::digitalBits));
-    const float baseSRParam = *apvts.getRawParameterValue(ParameterIDs::digitalSR);
-    const float jitterAmount = *apvts.getRawParameterValue(ParameterIDs::digitalJitter);
-    const bool useAntiAlias = *apvts.getRawParameterValue(ParameterIDs::digitalAA) > 0.5f;
+    const int baseBitsParam = params.digitalBits;
+    const float baseSRParam = params.digitalSR;
+    const float jitterAmount = params.digitalJitter;
+    const bool useAntiAlias = params.digitalAA;
+    const auto holdMode = static_cast<HoldMode>(juce::jlimit(0, 1, params.digitalSRMode));
     
     // Convert parameter ranges to mix amounts with smoother scaling curve
     float bitsNormalized = (baseBitsParam - 4.0f) / (16.0f - 4.0f); // 0.0 to 1.0
@@ -115,22 +144,27 @@ void Digital::process(juce::AudioBuffer<float>& buffer,
     const float finalSRMix = juce::jlimit(0.0f, 1.0f, srMixAmount + macroSRReduction);
     const float finalBitsMix = juce::jlimit(0.0f, 1.0f, bitsMixAmount + macroBitsReduction);
     
+    // The strobe follows the parameter, and the macro's floor when that is lower
+    const float targetStrobeRate = juce::jlimit(minStrobeRate, maxStrobeRate, juce::jmin(baseSRParam, macro.digitalSRFloorHz()));
+    
     // Skip processing entirely if both mixes are near zero (fully dry)
     if (finalSRMix < 0.01f && finalBitsMix < 0.01f)
         return;
     
-    // Use much more aggressive sample rate reduction for more obvious effect
-    const float fixedSampleRate = 8000.0f; // Lower fixed SR for more dramatic effect
-    // Map bit depth with smoother distribution: high mix = low bits (more quantization)
-    // Use a gentler curve that spreads the effect more evenly across the range
-    const float scaledMix = std::pow(finalBitsMix, 0.8f); // Gentler curve for bit mapping
-    juce::ignoreUnused(scaledMix); // Used in individual sample processing
+    jassert(scratchArena != nullptr);
+    if (scratchArena == nullptr)
+        return;
     
-    // Update anti-alias filter
-    if (useAntiAlias)
-    {
-        updateBiquadCoeffs(fixedSampleRate * 0.45f);
-    }
+    ScratchArena::Scope scratchScope(*scratchArena);
+    float* held = scratchArena->getFloats(numSamples);
+    float* bitsMix = scratchArena->getFloats(numSamples);
+    float* crushed = scratchArena->getFloats(numSamples);
+    if (held == nullptr || bitsMix == nullptr || crushed == nullptr)
+        return;
+    
+    // Clock jitter noise for the strobe; crushed is free until the crusher runs
+    jassert(blockRandom != nullptr);
+    float* jitterNoise = (jitterAmount > 0.0f && blockRandom != nullptr) ? crushed : nullptr;
     
     for (int ch = 0; ch < juce::jmin(bufferChannels, static_cast<int>(channels.size())); ++ch)
     {
@@ -141,67 +175,100 @@ void Digital::process(juce::AudioBuffer<float>& buffer,
         channel.smoothedBits.setTargetValue(finalBitsMix);
         channel.smoothedSampleRate.setTargetValue(finalSRMix);
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        const bool srActive = channel.smoothedSampleRate.getCurrentValue() > 0.01f || finalSRMix > 0.01f;
+        const bool bitsActive = channel.smoothedBits.getCurrentValue() > 0.01f || finalBitsMix > 0.01f;
+        
+        // Band-limited hold needs room for this block plus the tail of its last step
+        const bool bandLimited = holdMode == HoldMode::BandLimited
+                              && static_cast<int>(channel.blepCorrection.size()) >= numSamples + MinBlepTable::length;
+        float* blepCorrection = bandLimited ? channel.blepCorrection.data() : nullptr;
+        
+        // Residuals left over from the other mode would land as a click on the way back
+        if (! bandLimited)
+            std::fill(channel.blepCorrection.begin(), channel.blepCorrection.end(), 0.0f);
+        
+        // Sample rate reduction: one pass over the (anti-aliased) input, then mix it in
+        if (srActive)
         {
-            float dryInput = channelData[sample];
-            float wetOutput = dryInput;
+            if (jitterNoise != nullptr)
+                blockRandom->fillUniform(jitterNoise, numSamples);
             
-            // Get current mix amounts
-            const float currentBitsMix = channel.smoothedBits.getNextValue();
-            const float currentSRMix = channel.smoothedSampleRate.getNextValue();
+            channel.smoothedStrobeRate.setTargetValue(targetStrobeRate);
             
-            // Process with fixed "extreme" settings only if needed
-            if (currentSRMix > 0.01f || currentBitsMix > 0.01f)
+            // The strobe rate and the anti-alias response glide together, a sub-block at a time
+            for (int start = 0; start < numSamples; start += BiquadTable::subBlockSize)
             {
-                // Anti-alias filter
-                if (useAntiAlias)
-                {
-                    wetOutput = processBiquadFilter(channel, wetOutput);
-                }
+                const int subBlockSamples = juce::jmin(BiquadTable::subBlockSize, numSamples - start);
+                const float strobeRate = channel.smoothedStrobeRate.skip(subBlockSamples);
+                const float* source = channelData + start;
                 
-                // Sample rate reduction (always apply with fixed rate when mix > 0)
-                if (currentSRMix > 0.01f)
+                if (useAntiAlias)
                 {
-                    wetOutput = processSampleRateReduction(channel, wetOutput, fixedSampleRate, jitterAmount);
+                    if (antiAliasTable.update(strobeRate))
+                    {
+                        const auto& c = antiAliasTable.getCurrent();
+                        currentCoeffs = { c[0], c[1], c[2], c[4], c[5] };
+                    }
+                    
+                    for (int sample = start; sample < start + subBlockSamples; ++sample)
+                        held[sample] = processBiquadFilter(channel, channelData[sample]);
+                    
+                    source = held + start;
                 }
                 
-                // Bit depth reduction (apply with variable bits when mix > 0)
-                if (currentBitsMix > 0.01f)
-                {
-                    // Calculate current target bits based on smoothed mix amount
-                    const float currentScaledMix = std::pow(currentBitsMix, 0.8f);
-                    const float currentTargetBits = 16.0f - (currentScaledMix * 12.0f);
-                    wetOutput = processHardQuantization(channel, wetOutput, currentTargetBits);
-                }
+                processSampleRateReductionBlock(channel, source, held + start, subBlockSamples, strobeRate,
+                                                jitterNoise != nullptr ? jitterNoise + start : nullptr, jitterAmount,
+                                                blepCorrection != nullptr ? blepCorrection + start : nullptr);
             }
             
-            // Always apply consistent wet/dry mixing - don't skip SRR based on bitcrush level
-            float finalOutput = dryInput;
-            
-            // Apply sample rate reduction mix first (always if enabled)
-            if (currentSRMix > 0.01f)
+            if (blepCorrection != nullptr)
             {
-                // Create SRR-only processed signal for clean mixing
-                float srrOnlyOutput = dryInput;
-                srrOnlyOutput = processSampleRateReduction(channel, srrOnlyOutput, fixedSampleRate, jitterAmount);
-                
-                // Mix dry input with SRR-only output
-                finalOutput = dryInput * (1.0f - currentSRMix) + srrOnlyOutput * currentSRMix;
+                // Smooth this block's steps, then carry the residuals that run into the next one
+                juce::FloatVectorOperations::add(held, blepCorrection, numSamples);
+                std::copy(blepCorrection + numSamples, blepCorrection + numSamples + MinBlepTable::length, blepCorrection);
+                juce::FloatVectorOperations::clear(blepCorrection + MinBlepTable::length, numSamples);
             }
             
-            // Apply bit depth reduction mix (independently of SR processing)
-            if (currentBitsMix > 0.01f)
+            // Mix dry input with SRR-only output
+            if (channel.smoothedSampleRate.isSmoothing())
             {
-                // Always process bit reduction on the current signal state
-                const float currentScaledMix = std::pow(currentBitsMix, 0.8f);
-                const float currentTargetBits = 16.0f - (currentScaledMix * 12.0f);
-                float bitProcessedOutput = processHardQuantization(channel, finalOutput, currentTargetBits);
-                
-                // Mix current signal with bit-processed signal
-                finalOutput = finalOutput * (1.0f - currentBitsMix) + bitProcessedOutput * currentBitsMix;
+                for (int sample = 0; sample < numSamples; ++sample)
+                {
+                    const float currentSRMix = channel.smoothedSampleRate.getNextValue();
+                    channelData[sample] += (held[sample] - channelData[sample]) * currentSRMix;
+                }
+            }
+            else
+            {
+                juce::FloatVectorOperations::multiply(channelData, 1.0f - finalSRMix, numSamples);
+                juce::FloatVectorOperations::addWithMultiply(channelData, held, finalSRMix, numSamples);
+            }
+        }
+        else
+        {
+            channel.smoothedSampleRate.skip(numSamples);
+            channel.smoothedStrobeRate.setCurrentAndTargetValue(targetStrobeRate);
+        }
+        
+        // Bit depth reduction mix (independently of SR processing), on the SR-mixed signal.
+        // The crusher costs the same whether or not the mix is gliding: it always reads a mix per sample.
+        if (bitsActive)
+        {
+            if (channel.smoothedBits.isSmoothing())
+            {
+                for (int sample = 0; sample < numSamples; ++sample)
+                    bitsMix[sample] = channel.smoothedBits.getNextValue();
+            }
+            else
+            {
+                juce::FloatVectorOperations::fill(bitsMix, finalBitsMix, numSamples);
             }
             
-            channelData[sample] = finalOutput;
+            processHardQuantizationBlock(channel, channelData, bitsMix, held, crushed, numSamples);
+        }
+        else
+        {
+            channel.smoothedBits.skip(numSamples);
         }
     }
 }
@@ -265,10 +332,73 @@ float Digital::processSampleRateReduction(ChannelState& channel, float input,
     return channel.heldSample;
 }
 
+void Digital::processSampleRateReductionBlock(ChannelState& channel, const float* input, float* held, int numSamples,
+                                             float targetSR, const float* jitterNoise, float jitterAmount,
+                                             float* blepCorrection) noexcept
+{
+    // Same strobe law as processSampleRateReduction(), but each run of held values
+    // between two strobes is written with one vector fill. input may equal held:
+    // a run is only written once every sample in it has been read.
+    const double nominalIncrement = static_cast<double>(targetSR) / hostSampleRate;
+    const float smoothingFactor = 0.85f; // Less smoothing for more character
+    
+    double phase = channel.phase;
+    float previousInput = channel.previousInput;
+    float heldSample = channel.heldSample;
+    float smoothedIncrement = channel.lastPhaseIncrement;
+    int runStart = 0;
+    
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        double phaseIncrement = nominalIncrement;
+        
+        // Apply jitter if requested - make it more pronounced
+        if (jitterNoise != nullptr)
+            phaseIncrement = juce::jmax(phaseIncrement * (1.0 + jitterOffsetFor(jitterNoise[sample], jitterAmount) * 2.0f), 0.0001);
+        
+        phaseIncrement = juce::jmin(phaseIncrement, 0.95); // Allow faster accumulation
+        
+        smoothedIncrement = smoothedIncrement * smoothingFactor + static_cast<float>(phaseIncrement) * (1.0f - smoothingFactor);
+        phase += static_cast<double>(smoothedIncrement);
+        
+        const float current = input[sample];
+        
+        if (phase >= 1.0)
+        {
+            // Calculate interpolation factor for sub-sample accuracy
+            const double interpFactor = (phase - 1.0) / static_cast<double>(smoothedIncrement);
+            
+            // Use less interpolation for more aliasing, plus some raw input for more aliasing
+            const float strobed = previousInput + (current - previousInput) * (1.0f - static_cast<float>(interpFactor)) * 0.7f
+                                + current * 0.3f;
+            
+            if (sample > runStart)
+                juce::FloatVectorOperations::fill(held + runStart, heldSample, sample - runStart);
+            
+            // The step really happened interpFactor of a sample ago
+            if (blepCorrection != nullptr)
+                minBlep.addStep(blepCorrection + sample, static_cast<float>(interpFactor), strobed - heldSample);
+            
+            heldSample = strobed;
+            runStart = sample;
+            phase = std::fmod(phase, 1.0);
+        }
+        
+        previousInput = current;
+    }
+    
+    juce::FloatVectorOperations::fill(held + runStart, heldSample, numSamples - runStart);
+    
+    channel.phase = phase;
+    channel.previousInput = previousInput;
+    channel.heldSample = heldSample;
+    channel.lastPhaseIncrement = smoothedIncrement;
+}
+
 float Digital::processBitDepthReduction(ChannelState& channel, float input, float bits) noexcept
 {
     // Mid-tread quantizer with proper step size
-    const float stepSize = 2.0f / (std::pow(2.0f, bits) - 1.0f);
+    const float stepSize = bitsToStepTable.processSample(bits);
     
     // Add TPDF dither
     float dither = generateTPDFDither(stepSize);
@@ -289,87 +419,97 @@ float Digital::processBitDepthReduction(ChannelState& channel, float input, floa
     return juce::jlimit(-1.0f, 1.0f, quantized);
 }
 
-float Digital::processHardQuantization(ChannelState& channel, float input, float bits) noexcept
+void Digital::processHardQuantizationBlock(ChannelState& channel, float* data, const float* bitsMix,
+                                           float* highs, float* crushed, int numSamples) noexcept
 {
     // Enhanced frequency-selective bitcrushing - heavily target low frequencies
+    // (600Hz crossover, filter coefficients from prepare())
+    const float alpha = crossoverAlpha;
+    float highpassState = channel.highpassState;
+    float previousInput = channel.previousInputForHP;
     
-    // Use even lower crossover to focus more on bass/low-mids
-    const float crossoverFreq = 600.0f; // Hz - lower to target more of the low end
-    const float rc = 1.0f / (2.0f * juce::MathConstants<float>::pi * crossoverFreq);
-    const float dt = 1.0f / static_cast<float>(hostSampleRate);
-    const float alpha = rc / (rc + dt);
-    
-    // Apply 1-pole highpass filter
-    float highFreqs = alpha * (channel.highpassState + input - channel.previousInputForHP);
-    channel.highpassState = highFreqs;
-    channel.previousInputForHP = input;
-    
-    // Low frequencies = total - high frequencies  
-    float lowFreqs = input - highFreqs;
-    
-    // Apply additional low-end boost before quantization for more aggressive targeting
-    lowFreqs *= 1.8f; // Increased boost to emphasize low frequency content
-    
-    // Apply EXTREMELY aggressive quantization to low frequencies only
-    float scaledLows = lowFreqs * 2.5f; // Drive even harder for more low-end destruction
-    
-    // Hard quantization with no dithering for maximum gnarl on lows only
-    const float levels = std::pow(2.0f, bits) - 1.0f;
-    const float stepSize = 2.0f / levels;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Apply 1-pole highpass filter
+        const float input = data[i];
+        highpassState = alpha * (highpassState + input - previousInput);
+        previousInput = input;
+        highs[i] = highpassState;
+        
+        // Low frequencies = total - high frequencies, boosted 1.8x and driven 2.5x
+        // into the quantizer for more low-end destruction
+        crushed[i] = (input - highpassState) * (1.8f * 2.5f);
+    }
     
-    // Aggressive quantization with floor/ceiling for harsh stepping on lows
-    float quantizedLows;
-    if (scaledLows >= 0.0f)
-        quantizedLows = std::floor(scaledLows / stepSize + 0.5f) * stepSize;
-    else
-        quantizedLows = std::ceil(scaledLows / stepSize - 0.5f) * stepSize;
+    channel.highpassState = highpassState;
+    channel.previousInputForHP = previousInput;
     
-    // Apply aliasing and distortion for extra digital nastiness
-    if (bits <= 10.0f)
+    // The quantizer and its shaping are memoryless, so they run straight down the block
+    // with every curve read from the tables built in the constructor
+    for (int i = 0; i < numSamples; ++i)
     {
-        // Cubic distortion for harmonic generation
-        float distortion = quantizedLows * quantizedLows * quantizedLows * 0.4f;
-        quantizedLows += distortion * (1.0f - bits / 10.0f);
+        const float bits = mixToBitsTable.processSampleUnchecked(bitsMix[i]);
+        const float stepSize = bitsToStepTable.processSampleUnchecked(bits);
+        const float scaledLows = crushed[i];
+        
+        // Hard quantization with no dithering, halves rounded away from zero for harsh stepping
+        float quantizedLows = std::trunc(scaledLows / stepSize + std::copysign(0.5f, scaledLows)) * stepSize;
+        
+        // Cubic distortion for harmonic generation below 10 bits
+        quantizedLows += quantizedLows * quantizedLows * quantizedLows * 0.4f * juce::jmax(0.0f, 1.0f - bits / 10.0f);
         
         // Add some intermodulation at very low bit depths
-        if (bits <= 6.0f)
+        const float imdAmount = juce::jmax(0.0f, 1.0f - bits / 6.0f);
+        if (imdAmount > 0.0f)
         {
-            float imd = std::sin(quantizedLows * 8.0f) * 0.15f * (1.0f - bits / 6.0f);
-            quantizedLows += imd;
+            float phase = quantizedLows * 8.0f;
+            phase -= juce::MathConstants<float>::twoPi * std::round(phase * (1.0f / juce::MathConstants<float>::twoPi));
+            quantizedLows += sineTable.processSample(phase) * 0.15f * imdAmount;
         }
+        
+        // Saturate to control levels but keep the gnarl, with the +3.5dB low-end emphasis folded in
+        crushed[i] = saturationTable.processSample(quantizedLows);
     }
     
-    // Saturate to control levels but keep the gnarl
-    quantizedLows = std::tanh(quantizedLows * 0.7f) / 0.7f;
-    
-    // Add even more low-end emphasis to the crushed signal
-    quantizedLows *= 1.5f; // +3.5dB boost for more low-end presence
-    
-    // Hi-damping filter after bit reduction - gentle high-frequency rolloff
-    const float hiDampCutoff = 8000.0f; // Hz - rolloff highs for analog warmth
-    const float hiDampRc = 1.0f / (2.0f * juce::MathConstants<float>::pi * hiDampCutoff);
-    const float hiDampAlpha = dt / (hiDampRc + dt);
+    float lowpassState = channel.lowpassState;
+    float lowpassState2 = channel.lowpassState2;
     
-    channel.lowpassState2 = channel.lowpassState2 + hiDampAlpha * (quantizedLows - channel.lowpassState2);
-    quantizedLows = quantizedLows * 0.7f + channel.lowpassState2 * 0.3f; // Apply hi-damping
-    
-    // Only apply additional smoothing at extremely low bit depths
-    if (bits <= 5.0f)
+    for (int i = 0; i < numSamples; ++i)
     {
-        const float lpCutoff = 3500.0f; // Lower cutoff for more analog feel
-        const float lpRc = 1.0f / (2.0f * juce::MathConstants<float>::pi * lpCutoff);
-        const float lpAlpha = dt / (lpRc + dt);
+        float quantizedLows = crushed[i];
+        
+        // Hi-damping filter after bit reduction - gentle high-frequency rolloff at 8kHz
+        lowpassState2 += hiDampAlpha * (quantizedLows - lowpassState2);
+        quantizedLows = quantizedLows * 0.7f + lowpassState2 * 0.3f;
+        
+        // Only apply additional smoothing at extremely low bit depths (5 bits and under)
+        if (bitsMix[i] >= extremeLowpassMix)
+        {
+            lowpassState += extremeLowpassAlpha * (quantizedLows - lowpassState);
+            quantizedLows = quantizedLows * 0.75f + lowpassState * 0.25f;
+        }
+        
+        quantizedLows = juce::jlimit(-1.5f, 1.5f, quantizedLows);
         
-        channel.lowpassState = channel.lowpassState + lpAlpha * (quantizedLows - channel.lowpassState);
-        quantizedLows = quantizedLows * 0.75f + channel.lowpassState * 0.25f; // More filtering at extreme settings
+        // Combine: clean highs + heavily crushed and hi-damped lows, then mix it in
+        const float output = juce::jlimit(-1.3f, 1.3f, highs[i] + quantizedLows);
+        data[i] += (output - data[i]) * bitsMix[i];
     }
     
-    quantizedLows = juce::jlimit(-1.5f, 1.5f, quantizedLows);
-    
-    // Combine: clean highs + heavily crushed and hi-damped lows
-    float output = highFreqs + quantizedLows;
-    
-    return juce::jlimit(-1.3f, 1.3f, output);
+    channel.lowpassState = lowpassState;
+    channel.lowpassState2 = lowpassState2;
+}
+
+float Digital::mixToBits(float bitsMix) noexcept
+{
+    // High mix = low bits (more quantization), on a gentler curve that spreads the effect more evenly
+    return 16.0f - std::pow(bitsMix, 0.8f) * 12.0f;
+}
+
+float Digital::stepSizeForBits(float bits) noexcept
+{
+    // Mid-tread step size for a (fractional) bit depth
+    return 2.0f / (std::pow(2.0f, bits) - 1.0f);
 }
 
 void Digital::updateBiquadCoeffs(float cutoffFreq) noexcept
@@ -393,16 +533,23 @@ void Digital::updateBiquadCoeffs(float cutoffFreq) noexcept
 float Digital::generateTPDFDither(float stepSize) noexcept
 {
     // Triangular Probability Density Function dither (sum of two uniform distributions)
-    float uniform1 = (random.nextFloat() - 0.5f) * stepSize;
-    float uniform2 = (random.nextFloat() - 0.5f) * stepSize;
+    if (blockRandom == nullptr)
+        return 0.0f;
+    
+    float uniform1 = blockRandom->nextFloat() * 0.5f * stepSize;
+    float uniform2 = blockRandom->nextFloat() * 0.5f * stepSize;
     return (uniform1 + uniform2) * 0.5f;
 }
 
 float Digital::generateJitterOffset(float amount) noexcept
 {
-    // Zero-mean jitter for clock instability
-    float jitter = (random.nextFloat() - 0.5f) * 2.0f * amount;
-    return juce::jlimit(-0.5f, 0.5f, jitter * 0.1f);
+    return blockRandom != nullptr ? jitterOffsetFor(blockRandom->nextFloat(), amount) : 0.0f;
+}
+
+float Digital::jitterOffsetFor(float noise, float amount) noexcept
+{
+    // Zero-mean jitter for clock instability, from uniform noise on [-1, 1)
+    return juce::jlimit(-0.5f, 0.5f, noise * amount * 0.1f);
 }
 
 // Legacy compatibility methods (minimal implementations)
@@ -451,7 +598,7 @@ float Digital::quantizeWithDither(float input, int bits, float) noexcept
 
 float Digital::quantizeHard(float input, int bits) noexcept 
 { 
-    const float stepSize = 2.0f / (std::pow(2.0f, bits) - 1.0f);
+    const float stepSize = bitsToStepTable.processSample(static_cast<float>(bits));
     float quantized = std::round(input / stepSize) * stepSize;
     return juce::jlimit(-1.0f, 1.0f, quantized);
 }
@@ -2,12 +2,17 @@
 
 #include <JuceHeader.h>
 #include "../core/Params.h"
+#include "../core/ScratchArena.h"
+#include "../core/BlockRandom.h"
+#include "shared/BiquadTable.h"
+#include "shared/MinBlepTable.h"
 
 namespace ReallyCheap
 {
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 /**
  * Digital Module - Virtual ADC Model
@@ -18,13 +23,20 @@ class MacroController;
  * - Optional 1st-order noise shaping for bits ≤ 8
  * 
  * SRR (Sample Rate Reduction): Phase-accumulator strobe with linear interpolation
+ * - Strobes at the Sample Rate parameter, capped by the macro's floor
  * - Phase accumulates at targetSR / hostSR rate
  * - Strobes (samples) when phase ≥ 1
  * - Linear interpolation for sub-sample accuracy
  * - Jitter modulates phase increment
+ * - Hold: naive, or band-limited with a minBLEP residual added at every strobe
+ *   so the steps stop folding back from the host rate
  * 
  * Anti-alias: Biquad lowpass at 0.45 * targetSR when enabled
  * Signal flow: Input → (AA filter) → SRR → BRR → Output
+ * 
+ * SRR runs once per block per channel: the strobe points come out of the
+ * phase accumulator first, then each run of held values is filled in one go.
+ * BRR likewise runs a block at a time, with its curves read from tables.
  */
 class Digital
 {
@@ -36,8 +48,20 @@ public:
     void reset();
     void process(juce::AudioBuffer<float>& buffer, 
                  juce::AudioPlayHead* playHead, 
-                 juce::AudioProcessorValueTreeState& apvts,
+                 const ParamSnapshot& params,
                  const MacroController& macro) noexcept;
+    
+    // Temporary buffers are taken from this arena; it must outlive the module
+    void setScratchArena(ScratchArena& arena) noexcept { scratchArena = &arena; }
+    
+    // Dither and clock jitter are drawn from this generator; it must outlive the module
+    void setBlockRandom(BlockRandom& generator) noexcept { blockRandom = &generator; }
+
+    enum class HoldMode
+    {
+        Naive = 0,
+        BandLimited
+    };
 
 private:
     // Enable 1st-order noise shaping for low bit depths
@@ -77,6 +101,10 @@ private:
         juce::SmoothedValue<float> smoothedBits;
         juce::SmoothedValue<float> smoothedSampleRate;
         juce::SmoothedValue<float> smoothedCutoff;
+        juce::SmoothedValue<float> smoothedStrobeRate;
+        
+        // Band-limited step residuals not yet added to the output, blockSize + MinBlepTable::length
+        std::vector<float> blepCorrection;
     };
     
     std::vector<ChannelState> channels;
@@ -84,25 +112,52 @@ private:
     // Global state
     double hostSampleRate = 44100.0;
     int numChannels = 2;
-    juce::Random random;
+    ScratchArena* scratchArena = nullptr;
+    BlockRandom* blockRandom = nullptr;
+    
+    // Range of the Sample Rate parameter, which the SRR strobes at; the mix sets how much of it is heard
+    static constexpr float minStrobeRate = 6000.0f;
+    static constexpr float maxStrobeRate = 44100.0f;
     
     // Current filter coefficients
     BiquadCoeffs currentCoeffs;
     float lastCutoffFreq = 0.0f;
     
+    // Anti-alias response at 0.45 of each strobe rate, designed in prepare()
+    BiquadTable antiAliasTable;
+    MinBlepTable minBlep;
+    
+    // One-pole coefficients for the frequency-selective crusher, set in prepare()
+    float crossoverAlpha = 0.0f;
+    float hiDampAlpha = 0.0f;
+    float extremeLowpassAlpha = 0.0f;
+    
+    // Crusher curves, sampled in the constructor so the audio thread never calls pow, sin or tanh
+    juce::dsp::LookupTableTransform<float> mixToBitsTable;   // Bits mix 0..1 -> bit depth 16..4
+    juce::dsp::LookupTableTransform<float> bitsToStepTable;  // Bit depth 4..16 -> quantizer step size
+    juce::dsp::LookupTableTransform<float> sineTable;        // One period, for the low-bit intermodulation
+    juce::dsp::LookupTableTransform<float> saturationTable;  // Output soft clip with its 1.5x makeup
+    float extremeLowpassMix = 1.0f;                          // Mix at which the bit depth reaches 5
+    
     // Processing methods
     float processBiquadFilter(ChannelState& channel, float input) noexcept;
     float processSampleRateReduction(ChannelState& channel, float input, 
                                     float targetSR, float jitterAmount) noexcept;
+    void processSampleRateReductionBlock(ChannelState& channel, const float* input, float* held, int numSamples,
+                                         float targetSR, const float* jitterNoise, float jitterAmount,
+                                         float* blepCorrection) noexcept;
     float processBitDepthReduction(ChannelState& channel, float input, 
                                   float bits) noexcept;
-    float processHardQuantization(ChannelState& channel, float input, 
-                                 float bits) noexcept;
+    void processHardQuantizationBlock(ChannelState& channel, float* data, const float* bitsMix,
+                                      float* highs, float* crushed, int numSamples) noexcept;
+    static float mixToBits(float bitsMix) noexcept;
+    static float stepSizeForBits(float bits) noexcept;
     
     // Helper methods
     void updateBiquadCoeffs(float cutoffFreq) noexcept;
     float generateTPDFDither(float stepSize) noexcept;
     float generateJitterOffset(float amount) noexcept;
+    static float jitterOffsetFor(float noise, float amount) noexcept;
     
     // Parameter mapping
     static float mapBitsToSmoothed(int bits) noexcept;
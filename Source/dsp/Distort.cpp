@@ -1,5 +1,6 @@
 #include "Distort.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 #include <cmath>
 
 namespace ReallyCheap
@@ -13,24 +14,45 @@ void Distort::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
     maxSamplesPerBlock = samplesPerBlock;
     numChannels = numChannels_;
 
-    // 4x oversampling for all modes to prevent aliasing
-    oversampler = std::make_unique<juce::dsp::Oversampling<float>>(
-        numChannels, 2, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, 
-        true, false);
+    // Every factor above 1x gets its own oversampler now, so changing factor later only
+    // resets one. Linear phase, because the output is summed with copies delayed by a whole
+    // number of samples - the dry path and the adaptive hand-over's linear path - and only a
+    // linear-phase round trip is exactly that delay all the way up the band.
+    // A shared chain already oversamples, so the stages are left empty there.
+    const bool inChain = chainFactor > 1;
+    int maxLatency = 0;
+    for (int factor = 1; factor < numFactors; ++factor)
+    {
+        auto& oversampler = oversamplers[(size_t) factor];
+        oversampler.prepare(numChannels, samplesPerBlock, inChain ? 0 : factor, HalfbandOversampler::Phase::linear);
+        factorLatency[(size_t) factor] = oversampler.getLatencySamples();
+        maxLatency = juce::jmax(maxLatency, factorLatency[(size_t) factor]);
+    }
     
-    oversampler->initProcessing(samplesPerBlock);
-    latencySamples = static_cast<int>(oversampler->getLatencyInSamples());
+    // Second-order ADAA at 1x answers one sample late; the chain's own ADAA is first order at most
+    factorLatency[0] = inChain ? 0 : 1;
     
-    oversampledBuffer.setSize(numChannels, samplesPerBlock * 4);
-    dryDelayBuffer.setSize(numChannels, samplesPerBlock + latencySamples + 64);
+    dryDelayBuffer.setSize(numChannels, samplesPerBlock + maxLatency + 64);
     dryDelayBuffer.clear();
+    
+    shaperHistory.setSize(numChannels, samplesPerBlock + maxLatency + kPrimeSamples);
+    linearPathBuffer.setSize(numChannels, samplesPerBlock);
+    primeBuffer.setSize(numChannels, juce::jmin(kPrimeSamples, samplesPerBlock));
+    linearHoldSamples = static_cast<int>(std::ceil(kLinearHoldSeconds * sampleRate));
 
+    // The filters are linear and sit either side of the shaper, so they run at the host
+    // rate whatever the oversampling; only the shaper itself sees the higher rate
     juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate * 4; // Oversampled rate for filters
-    spec.maximumBlockSize = samplesPerBlock * 4;
+    spec.sampleRate = sampleRate;
+    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = 1;
 
-    for (int ch = 0; ch < 2; ++ch)
+    preEmphasisFilters.resize(static_cast<size_t>(numChannels));
+    deEmphasisFilters.resize(static_cast<size_t>(numChannels));
+    toneFilters.resize(static_cast<size_t>(numChannels));
+    dcBlockFilters.resize(static_cast<size_t>(numChannels));
+
+    for (size_t ch = 0; ch < toneFilters.size(); ++ch)
     {
         auto& preEmph = preEmphasisFilters[ch];
         auto& deEmph = deEmphasisFilters[ch];
@@ -44,17 +66,17 @@ void Distort::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
 
         // Gentler pre-emphasis for smoother saturation
         preEmph.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            sampleRate * 4, 2000.0f, 0.5f, 1.2f); // Reduced boost
+            sampleRate, 2000.0f, 0.5f, 1.2f); // Reduced boost
         deEmph.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            sampleRate * 4, 2000.0f, 0.5f, 1.0f / 1.2f);
+            sampleRate, 2000.0f, 0.5f, 1.0f / 1.2f);
         
         // Start with flat tone response
         tone.coefficients = juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            sampleRate * 4, 1000.0f, 0.707f, 1.0f);
+            sampleRate, 1000.0f, 0.707f, 1.0f);
         
         // DC blocker
         dcBlock.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            sampleRate * 4, 20.0f);
+            sampleRate, 20.0f);
 
         preEmph.reset();
         deEmph.reset();
@@ -62,18 +84,83 @@ void Distort::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
         dcBlock.reset();
     }
 
+    // Gentler tone control: negative = darker, positive = brighter.
+    // Cut highs for darker tone - use shelf throughout for consistency; boost highs for brighter tone.
+    const double hostRate = sampleRate;
+    toneTable.prepare(-1.0f, 1.0f, [hostRate] (float tone)
+    {
+        const float freq = 1000.0f * std::pow(2.0f, tone * 1.5f); // ±1.5 octaves (reduced)
+        const float q = 0.5f; // Gentler Q
+        const float gain = 1.0f + std::abs(tone) * 1.5f; // Reduced max gain
+        
+        return tone < 0
+            ? juce::dsp::IIR::ArrayCoefficients<float>::makeLowShelf(hostRate, freq, q, 1.0f / gain)
+            : juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf(hostRate, freq, q, gain);
+    });
+    
+    toneSmoothed.reset(sampleRate, 0.02);
+    toneSmoothed.setCurrentAndTargetValue(0.0f);
+
+    adaaStates.assign(static_cast<size_t>(numChannels), {});
+    adaaShaper = &getAdaaShapers()[(size_t) currentType];
+    selectOversampling(currentOS);
+    
     dryDelayWritePos = 0;
+    
+    tailSamples = maxLatency + static_cast<int>(std::ceil(kSettleSeconds * sampleRate));
+    tailTracker.prepare(tailSamples);
+}
+
+const std::array<AdaaShaper, Distort::numShapers>& Distort::getAdaaShapers()
+{
+    static const auto shapers = []
+    {
+        std::array<AdaaShaper, numShapers> tables;
+        tables[(size_t) DistortType::Tape].build(shape<DistortType::Tape>);
+        tables[(size_t) DistortType::Diode].build(shape<DistortType::Diode>);
+        tables[(size_t) DistortType::Fold].build(shape<DistortType::Fold>);
+        return tables;
+    }();
+    
+    return shapers;
+}
+
+void Distort::selectOversampling(OversamplingFactor factor) noexcept
+{
+    const auto index = static_cast<size_t>(factor);
+    currentOS = factor;
+    
+    // 1x leans on second-order ADAA, 2x on first order; 4x and up have the headroom to shape plainly.
+    // In a shared chain Distort itself stays at 1x and the chain's factor counts instead.
+    const int totalFactor = (1 << static_cast<int>(index)) * chainFactor;
+    adaaOrder = totalFactor == 1 ? 2 : (totalFactor == 2 ? 1 : 0);
+    latencySamples = factorLatency[index];
+    
+    // The filters carry on at the host rate; only the shaper's own history is stale
+    oversamplers[index].reset();
+    
+    oversamplingEngaged = false;
+    linearHoldRemaining = 0;
+    
+    for (auto& state : adaaStates)
+        state.reset();
 }
 
 void Distort::reset()
 {
-    if (oversampler)
-        oversampler->reset();
+    clearFilterState();
+    clearDryDelay();
+    toneSmoothed.setCurrentAndTargetValue(toneSmoothed.getTargetValue());
     
-    oversampledBuffer.clear();
-    dryDelayBuffer.clear();
+    tailTracker.wake();
+}
+
+void Distort::clearFilterState() noexcept
+{
+    for (auto& oversampler : oversamplers)
+        oversampler.reset();
     
-    for (int ch = 0; ch < 2; ++ch)
+    for (size_t ch = 0; ch < toneFilters.size(); ++ch)
     {
         preEmphasisFilters[ch].reset();
         deEmphasisFilters[ch].reset();
@@ -81,223 +168,348 @@ void Distort::reset()
         dcBlockFilters[ch].reset();
     }
     
+    for (auto& state : adaaStates)
+        state.reset();
+    
+    shaperHistory.clear();
+    shaperHistoryWritePos = 0;
+    oversamplingEngaged = false;
+    linearHoldRemaining = 0;
+}
+
+void Distort::clearDryDelay() noexcept
+{
+    dryDelayBuffer.clear();
     dryDelayWritePos = 0;
 }
 
+void Distort::alignDryPath(juce::AudioBuffer<float>& dryBuffer) noexcept
+{
+    const int delaySize = dryDelayBuffer.getNumSamples();
+    if (latencySamples <= 0 || delaySize <= latencySamples)
+        return;
+    
+    const int numSamples = dryBuffer.getNumSamples();
+    const int channels = juce::jmin(dryBuffer.getNumChannels(), dryDelayBuffer.getNumChannels());
+    int writePos = dryDelayWritePos;
+    
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        auto* data = dryBuffer.getWritePointer(ch);
+        auto* delay = dryDelayBuffer.getWritePointer(ch);
+        
+        writePos = dryDelayWritePos;
+        int readPos = writePos - latencySamples;
+        if (readPos < 0)
+            readPos += delaySize;
+        
+        for (int i = 0; i < numSamples; ++i)
+        {
+            delay[writePos] = data[i];
+            data[i] = delay[readPos];
+            
+            if (++writePos == delaySize) writePos = 0;
+            if (++readPos == delaySize) readPos = 0;
+        }
+    }
+    
+    dryDelayWritePos = writePos;
+}
+
+double Distort::getTailLengthSeconds() const noexcept
+{
+    return static_cast<double>(tailSamples) / sampleRate;
+}
+
 void Distort::process(juce::AudioBuffer<float>& buffer, juce::AudioPlayHead* playHead, 
-                     juce::AudioProcessorValueTreeState& apvts, const MacroController& macro) noexcept
+                     const ParamSnapshot& params, const MacroController& macro) noexcept
 {
     juce::ignoreUnused(playHead);
     juce::ScopedNoDenormals noDenormals;
     
-    updateParameters(apvts, macro);
+    updateParameters(params, macro);
     
     if (bypassed)
         return;
     
-    // Process with 4x oversampling to reduce aliasing
-    juce::dsp::AudioBlock<float> block(buffer);
-    auto oversampledBlock = oversampler->processSamplesUp(block);
-    
-    // Get oversampled buffer
-    auto* oversampledData = oversampledBlock.getChannelPointer(0);
-    const int oversampledNumSamples = static_cast<int>(oversampledBlock.getNumSamples());
+    const bool inputSilent = TailTracker::isSilent(buffer);
     
-    // Create temporary buffer for processing
-    juce::AudioBuffer<float> tempBuffer(buffer.getNumChannels(), oversampledNumSamples);
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    if (inputSilent && tailTracker.isSleeping())
     {
-        auto* src = oversampledBlock.getChannelPointer(ch);
-        auto* dst = tempBuffer.getWritePointer(ch);
-        std::copy(src, src + oversampledNumSamples, dst);
+        buffer.clear();
+        return;
     }
     
-    // Process at oversampled rate
-    processInternal(tempBuffer);
-    
-    // Copy back to oversampled block
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        auto* src = tempBuffer.getReadPointer(ch);
-        auto* dst = oversampledBlock.getChannelPointer(ch);
-        std::copy(src, src + oversampledNumSamples, dst);
-    }
+    processInternal(buffer);
     
-    // Downsample back to original rate
-    oversampler->processSamplesDown(block);
+    // Silent in and silent out for the settle time means nothing is left ringing
+    if (tailTracker.addBlock(inputSilent && TailTracker::isSilent(buffer), buffer.getNumSamples()))
+        clearFilterState();
 }
 
-void Distort::updateParameters(juce::AudioProcessorValueTreeState& apvts, const MacroController& macro) noexcept
+void Distort::updateParameters(const ParamSnapshot& params, const MacroController& macro) noexcept
 {
-    auto* distortOnParam = apvts.getRawParameterValue(ParameterIDs::distortOn);
-    setBypassed(!(distortOnParam->load() >= 0.5f));
+    // The dry delay only runs while Distort does, so drop what it held from last time
+    if (bypassed && params.distortOn)
+        clearDryDelay();
+    
+    setBypassed(! params.distortOn);
     
     if (bypassed)
         return;
 
-    auto* typeParam = apvts.getRawParameterValue(ParameterIDs::distortType);
-    auto* driveParam = apvts.getRawParameterValue(ParameterIDs::distortDrive);
-    auto* toneParam = apvts.getRawParameterValue(ParameterIDs::distortTone);
-
-    // Simple type selection (0-2 for three types)
-    int typeValue = static_cast<int>(typeParam->load());
-    currentType = static_cast<DistortType>(juce::jlimit(0, 2, typeValue));
+    const auto type = static_cast<DistortType>(juce::jlimit(0, numShapers - 1, params.distortType));
+    auto factor = static_cast<OversamplingFactor>(juce::jlimit(0, numFactors - 1, params.distortOversampling));
+    
+    // A shared oversampled chain stands in for Distort's own oversampling
+    if (chainFactor > 1)
+        factor = OversamplingFactor::x1;
+    
+    if (type != currentType)
+    {
+        currentType = type;
+        adaaShaper = &getAdaaShapers()[(size_t) currentType];
+        
+        for (auto& state : adaaStates)
+            state.reset();
+    }
+    
+    if (factor != currentOS)
+        selectOversampling(factor);
     
     // Apply macro modulation with guardrails
-    float baseDriveDb = driveParam->load();
+    float baseDriveDb = params.distortDrive;
     float modifiedDriveDb = juce::jlimit(0.0f, 40.0f, baseDriveDb + macro.distortDriveAddDb());
     currentDrive = juce::Decibels::decibelsToGain(modifiedDriveDb);
     
     // Tone control only (no bias for cleaner sound)
-    currentTone = toneParam->load();
-    currentBias = 0.0f; // Remove bias to prevent DC offset artifacts
+    toneSmoothed.setTargetValue(params.distortTone);
 }
 
 void Distort::processInternal(juce::AudioBuffer<float>& buffer) noexcept
 {
-    const auto numSamples = buffer.getNumSamples();
-    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
-
     // Apply tone shaping before distortion
-    applyToneShaping(buffer, true);
+    applyToneShaping(buffer);
     
     // Apply gentle pre-emphasis
     applyPreEmphasis(buffer);
 
+    if (currentOS == OversamplingFactor::x1)
+        processShaper(buffer);
+    else
+        processAdaptive(buffer);
+
+    // Remove DC offset
+    removeDC(buffer);
+    
+    // Apply de-emphasis
+    applyDeEmphasis(buffer);
+}
+
+void Distort::processAdaptive(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    const int channels = juce::jmin(buffer.getNumChannels(), numChannels);
+    
+    // Block peak of what the shaper is about to see; oversampling starts as soon as it leaves
+    // the linear region and stops only after a stretch of quiet
+    float peak = 0.0f;
     for (int ch = 0; ch < channels; ++ch)
+        peak = juce::jmax(peak, buffer.getMagnitude(ch, 0, numSamples));
+    
+    if (peak * currentDrive > kLinearPeak[(size_t) currentType])
+        linearHoldRemaining = linearHoldSamples;
+    else
+        linearHoldRemaining = juce::jmax(0, linearHoldRemaining - numSamples);
+    
+    const bool wantOversampling = linearHoldRemaining > 0;
+    const bool switching = wantOversampling != oversamplingEngaged;
+    
+    // The oversampler sat idle while it was not needed; run the recent past through it first
+    if (wantOversampling && ! oversamplingEngaged)
+        primeOversampler();
+    
+    writeShaperHistory(buffer, channels);
+    
+    // The linear path shapes at the host rate, delayed to the oversampled path's latency
+    if (! wantOversampling || switching)
+    {
+        readShaperHistory(linearPathBuffer, channels, numSamples + latencySamples, numSamples);
+        for (int ch = 0; ch < channels; ++ch)
+            applyPlainShaper(linearPathBuffer.getWritePointer(ch), numSamples);
+    }
+    
+    if (wantOversampling || oversamplingEngaged)
+        processOversampled(buffer);
+    
+    if (switching)
     {
-        auto* data = buffer.getWritePointer(ch);
+        // Short crossfade from the path that was running to the one taking over. Both carry the
+        // same latency, and the primed oversampler already agrees with the linear path on quiet input.
+        const int fadeLength = juce::jmin(numSamples, kCrossfadeSamples);
+        const float step = 1.0f / static_cast<float>(fadeLength);
         
-        for (int i = 0; i < numSamples; ++i)
+        for (int ch = 0; ch < channels; ++ch)
         {
-            float input = data[i];
-            float output = 0.0f;
-            
-            // Scale input by drive
-            input *= currentDrive;
+            auto* data = buffer.getWritePointer(ch);
+            const auto* linear = linearPathBuffer.getReadPointer(ch);
             
-            // Apply selected distortion type
-            switch (currentType)
+            for (int i = 0; i < numSamples; ++i)
             {
-                case DistortType::Tape:
-                    output = processTapeMode(input);
-                    break;
-                case DistortType::Diode:
-                    output = processDiodeMode(input);
-                    break;
-                case DistortType::Fold:
-                    output = processFoldMode(input);
-                    break;
-                default:
-                    output = processTapeMode(input);
-                    break;
+                const float toOversampled = juce::jmin(1.0f, static_cast<float>(i + 1) * step);
+                const float weight = wantOversampling ? toOversampled : 1.0f - toOversampled;
+                data[i] = linear[i] + weight * (data[i] - linear[i]);
             }
-            
-            // Apply output gain compensation based on drive amount
-            float compensation = 1.0f / (1.0f + currentDrive * 0.3f);
-            data[i] = output * compensation;
         }
     }
-
-    // Remove DC offset
-    removeDC(buffer);
+    else if (! wantOversampling)
+    {
+        for (int ch = 0; ch < channels; ++ch)
+            buffer.copyFrom(ch, 0, linearPathBuffer, ch, 0, numSamples);
+    }
     
-    // Apply de-emphasis
-    applyDeEmphasis(buffer);
+    oversamplingEngaged = wantOversampling;
 }
 
-float Distort::processTapeMode(float input) noexcept
+void Distort::processOversampled(juce::AudioBuffer<float>& buffer) noexcept
 {
-    // Improved tape saturation algorithm with smoother curve
-    // Based on modified hyperbolic tangent with asymmetry
-    
-    // Add subtle asymmetry for tape character
-    float asymmetry = 0.05f;
-    float biased = input + asymmetry * input * input;
+    auto& oversampler = oversamplers[(size_t) currentOS];
+    juce::dsp::AudioBlock<float> block(buffer);
+    auto oversampledBlock = oversampler.processSamplesUp(block);
     
-    // Soft saturation using tanh approximation
-    // This approximation is smoother and less harsh than standard tanh
-    float x = biased * 0.7f; // Scale for gentler saturation
-    float x2 = x * x;
+    // Work on the oversampler's own storage rather than copying it out and back
+    const int oversampledChannels = juce::jmin(static_cast<int>(oversampledBlock.getNumChannels()), ScratchArena::maxChannels);
+    float* oversampledChannelPointers[ScratchArena::maxChannels] = {};
+    for (int ch = 0; ch < oversampledChannels; ++ch)
+        oversampledChannelPointers[ch] = oversampledBlock.getChannelPointer(static_cast<size_t>(ch));
     
-    // Padé approximation of tanh for smoother saturation
-    float num = x * (27.0f + x2);
-    float den = 27.0f + 9.0f * x2;
-    float output = num / den;
+    juce::AudioBuffer<float> oversampledView(oversampledChannelPointers, oversampledChannels,
+                                             static_cast<int>(oversampledBlock.getNumSamples()));
     
-    // Add subtle even harmonics for warmth
-    output += 0.02f * output * output * (input > 0 ? 1.0f : -1.0f);
+    // Only the nonlinearity runs at the oversampled rate
+    processShaper(oversampledView);
     
-    return output;
+    // Downsample back to original rate
+    oversampler.processSamplesDown(block);
 }
 
-float Distort::processDiodeMode(float input) noexcept
+void Distort::primeOversampler() noexcept
 {
-    // Cleaner diode clipping with softer saturation
-    // Models germanium characteristics with smoother transition
+    oversamplers[(size_t) currentOS].reset();
     
-    const float threshold = 0.5f; // Lower threshold for gentler clipping
-    const float softness = 0.8f; // Softer saturation curve
+    for (auto& state : adaaStates)
+        state.reset();
     
-    // Simple asymmetric soft clipping using tanh-based approach
-    float scaled = input * 1.5f; // Slight pre-gain
+    // Settles the halfband filters and ADAA history on the signal leading up to this block;
+    // the output is thrown away
+    const int channels = primeBuffer.getNumChannels();
+    const int chunkSize = primeBuffer.getNumSamples();
     
-    // Asymmetric behavior: slightly different for positive/negative
-    if (input >= 0.0f)
+    for (int done = 0; done < kPrimeSamples; done += chunkSize)
     {
-        // Positive half - standard soft clipping
-        if (input < threshold)
-            return input;
-        else
-            return threshold + (1.0f - threshold) * std::tanh((input - threshold) * softness);
+        const int chunk = juce::jmin(chunkSize, kPrimeSamples - done);
+        readShaperHistory(primeBuffer, channels, kPrimeSamples - done, chunk);
+        
+        juce::AudioBuffer<float> chunkView(primeBuffer.getArrayOfWritePointers(), channels, chunk);
+        processOversampled(chunkView);
     }
-    else
+}
+
+void Distort::writeShaperHistory(const juce::AudioBuffer<float>& buffer, int channels) noexcept
+{
+    const int size = shaperHistory.getNumSamples();
+    const int numSamples = buffer.getNumSamples();
+    const int firstPart = juce::jmin(numSamples, size - shaperHistoryWritePos);
+    
+    for (int ch = 0; ch < channels; ++ch)
     {
-        // Negative half - slightly harder clipping for asymmetry
-        float negThreshold = threshold * 0.8f;
-        if (input > -negThreshold)
-            return input;
-        else
-            return -negThreshold - (1.0f - negThreshold) * std::tanh((-input - negThreshold) * softness * 1.2f);
+        shaperHistory.copyFrom(ch, shaperHistoryWritePos, buffer, ch, 0, firstPart);
+        if (firstPart < numSamples)
+            shaperHistory.copyFrom(ch, 0, buffer, ch, firstPart, numSamples - firstPart);
     }
+    
+    shaperHistoryWritePos = (shaperHistoryWritePos + numSamples) % size;
 }
 
-float Distort::processFoldMode(float input) noexcept
+void Distort::readShaperHistory(juce::AudioBuffer<float>& dest, int channels, int samplesBack, int numSamples) const noexcept
 {
-    // Much gentler wavefolder for musical distortion
-    // Uses controlled triangle folding with soft transitions
+    const int size = shaperHistory.getNumSamples();
+    jassert(samplesBack <= size && numSamples <= dest.getNumSamples());
     
-    const float foldThreshold = 0.8f; // High threshold - less folding
-    const float foldAmount = 0.3f; // Reduced intensity
+    const int readPos = (shaperHistoryWritePos - samplesBack + size) % size;
+    const int firstPart = juce::jmin(numSamples, size - readPos);
     
-    float absInput = std::abs(input);
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        dest.copyFrom(ch, 0, shaperHistory, ch, readPos, firstPart);
+        if (firstPart < numSamples)
+            dest.copyFrom(ch, firstPart, shaperHistory, ch, 0, numSamples - firstPart);
+    }
+}
+
+void Distort::processShaper(juce::AudioBuffer<float>& buffer) noexcept
+{
+    const auto numSamples = buffer.getNumSamples();
+    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
+
+    for (int ch = 0; ch < channels; ++ch)
+        applyShaper(buffer.getWritePointer(ch), numSamples, adaaStates[(size_t) ch]);
+}
+
+void Distort::applyShaper(float* data, int numSamples, AdaaShaper::State& state) noexcept
+{
+    // Output gain compensation based on drive amount
+    const float drive = currentDrive;
+    const float compensation = 1.0f / (1.0f + drive * 0.3f);
     
-    if (absInput <= foldThreshold)
+    // ADAA carries state from sample to sample, so it stays a scalar loop
+    if (adaaOrder == 2)
     {
-        // No folding in linear region
-        return input;
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = adaaShaper->processSecondOrder(state, data[i] * drive) * compensation;
+        return;
     }
-    else
+    
+    if (adaaOrder == 1)
     {
-        // Gentle folding for signals above threshold
-        float excess = absInput - foldThreshold;
-        float foldedExcess = foldThreshold - excess * foldAmount;
-        
-        // Soft limit the folding to prevent extreme values
-        foldedExcess = juce::jmax(foldedExcess, foldThreshold * 0.5f);
-        
-        // Apply sign and blend with original
-        float folded = (input >= 0.0f) ? foldedExcess : -foldedExcess;
-        
-        // Blend original and folded for smoother transition
-        float blend = juce::jlimit(0.0f, 0.6f, (absInput - foldThreshold) * 2.0f);
-        return input * (1.0f - blend) + folded * blend;
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = adaaShaper->processFirstOrder(state, data[i] * drive) * compensation;
+        return;
+    }
+    
+    applyPlainShaper(data, numSamples);
+}
+
+void Distort::applyPlainShaper(float* data, int numSamples) noexcept
+{
+    const float drive = currentDrive;
+    const float compensation = 1.0f / (1.0f + drive * 0.3f);
+    
+    // Plain shaping picks its kernel once per block
+    switch (currentType)
+    {
+        case DistortType::Diode:
+            shapeBlock<DistortType::Diode>(data, numSamples, drive, compensation);
+            break;
+        case DistortType::Fold:
+            shapeBlock<DistortType::Fold>(data, numSamples, drive, compensation);
+            break;
+        default:
+            shapeBlock<DistortType::Tape>(data, numSamples, drive, compensation);
+            break;
     }
 }
 
+template <Distort::DistortType type>
+void Distort::shapeBlock(float* data, int numSamples, float drive, float compensation) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
+        data[i] = shape<type>(data[i] * drive) * compensation;
+}
+
 void Distort::applyPreEmphasis(juce::AudioBuffer<float>& buffer) noexcept
 {
-    const auto channels = juce::jmin(buffer.getNumChannels(), 2);
+    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
     
     for (int ch = 0; ch < channels; ++ch)
     {
@@ -309,7 +521,7 @@ void Distort::applyPreEmphasis(juce::AudioBuffer<float>& buffer) noexcept
 
 void Distort::applyDeEmphasis(juce::AudioBuffer<float>& buffer) noexcept
 {
-    const auto channels = juce::jmin(buffer.getNumChannels(), 2);
+    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
     
     for (int ch = 0; ch < channels; ++ch)
     {
@@ -319,48 +531,37 @@ void Distort::applyDeEmphasis(juce::AudioBuffer<float>& buffer) noexcept
     }
 }
 
-void Distort::applyToneShaping(juce::AudioBuffer<float>& buffer, bool isPreShaper) noexcept
+void Distort::applyToneShaping(juce::AudioBuffer<float>& buffer) noexcept
 {
-    if (std::abs(currentTone) < 0.01f)
+    if (! toneSmoothed.isSmoothing() && std::abs(toneSmoothed.getTargetValue()) < 0.01f)
         return;
     
-    const auto channels = juce::jmin(buffer.getNumChannels(), 2);
-    const float oversampleRate = sampleRate * 4; // We're processing at 4x rate
+    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
+    const int numSamples = buffer.getNumSamples();
     
-    for (int ch = 0; ch < channels; ++ch)
+    // The shelf glides with the tone control one sub-block at a time. Table entries are
+    // written into the existing coefficient objects, so nothing is designed or allocated here.
+    for (int start = 0; start < numSamples; start += BiquadTable::subBlockSize)
     {
-        // Gentler tone control: negative = darker, positive = brighter
-        float freq = 1000.0f * std::pow(2.0f, currentTone * 1.5f); // ±1.5 octaves (reduced)
-        float q = 0.5f; // Gentler Q
-        float gain = 1.0f + std::abs(currentTone) * 1.5f; // Reduced max gain
+        const int subBlockSamples = juce::jmin(BiquadTable::subBlockSize, numSamples - start);
+        const bool toneMoved = toneTable.update(toneSmoothed.skip(subBlockSamples));
         
-        if (currentTone < 0)
+        for (int ch = 0; ch < channels; ++ch)
         {
-            // Cut highs for darker tone - use shelf throughout for consistency
-            toneFilters[ch].coefficients = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-                oversampleRate, freq, q, 1.0f / gain);
-        }
-        else
-        {
-            // Boost highs for brighter tone
-            toneFilters[ch].coefficients = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-                oversampleRate, freq, q, gain);
+            if (toneMoved)
+                *toneFilters[ch].coefficients = toneTable.getCurrent();
+            
+            juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers() + ch, 1,
+                                               static_cast<size_t>(start), static_cast<size_t>(subBlockSamples));
+            juce::dsp::ProcessContextReplacing<float> context(block);
+            toneFilters[ch].process(context);
         }
-        
-        juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers() + ch, 1, buffer.getNumSamples());
-        juce::dsp::ProcessContextReplacing<float> context(block);
-        toneFilters[ch].process(context);
     }
 }
 
-void Distort::applyBias(juce::AudioBuffer<float>& buffer) noexcept
-{
-    // Removed bias application to prevent DC offset artifacts
-}
-
 void Distort::removeDC(juce::AudioBuffer<float>& buffer) noexcept
 {
-    const auto channels = juce::jmin(buffer.getNumChannels(), 2);
+    const auto channels = juce::jmin(buffer.getNumChannels(), numChannels);
     
     for (int ch = 0; ch < channels; ++ch)
     {
@@ -2,12 +2,20 @@
 
 #include <JuceHeader.h>
 #include "../core/Params.h"
+#include "../core/ScratchArena.h"
+#include "shared/TailTracker.h"
+#include "shared/BiquadTable.h"
+#include "shared/AdaaShaper.h"
+#include "shared/HalfbandOversampler.h"
+#include "shared/FastMath.h"
+#include <array>
 
 namespace ReallyCheap
 {
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 class Distort
 {
@@ -18,73 +26,189 @@ public:
     void prepare(double sampleRate, int samplesPerBlock, int numChannels);
     void reset();
     void process(juce::AudioBuffer<float>& buffer, juce::AudioPlayHead* playHead, 
-                juce::AudioProcessorValueTreeState& apvts, const MacroController& macro) noexcept;
+                const ParamSnapshot& params, const MacroController& macro) noexcept;
     
     int getLatencySamples() const noexcept { return latencySamples; }
+    
+    // Delays a copy of the unprocessed signal by the oversampler latency so it lines up with the output
+    void alignDryPath(juce::AudioBuffer<float>& dryBuffer) noexcept;
     void setBypassed(bool shouldBeBypassed) noexcept { bypassed = shouldBeBypassed; }
+    
+    // Inside a shared oversampled chain the shaper runs at the rate Distort is prepared at and
+    // its own oversampling steps aside; the ADAA order drops with the headroom the chain gives.
+    // Call before prepare().
+    void setChainOversampling(int factor) noexcept { chainFactor = juce::jmax(1, factor); }
+    
+    // True once the oversampler and filters have settled after the input went silent
+    bool isAsleep() const noexcept { return tailTracker.isSleeping(); }
+    double getTailLengthSeconds() const noexcept;
 
-private:
     enum class DistortType
     {
         Tape = 0,
         Diode = 1,
-        Fold = 2,
-        Tape2x = 3,
-        Diode2x = 4,
-        Fold2x = 5,
-        Tape4x = 6,
-        Diode4x = 7,
-        Fold4x = 8
+        Fold = 2
     };
 
+    // The shaper for one type, without drive or gain compensation. Written without branches
+    // or library calls so sample loops over it vectorize; specialised below the class.
+    template <DistortType type>
+    static float shape(float input) noexcept;
+
+private:
     enum class OversamplingFactor
     {
         x1 = 0,
         x2 = 1,
-        x4 = 2
+        x4 = 2,
+        x8 = 3
     };
 
-    void updateParameters(juce::AudioProcessorValueTreeState& apvts, const MacroController& macro) noexcept;
+    static constexpr int numFactors = 4;
+    static constexpr int numShapers = 3;
+
+    void updateParameters(const ParamSnapshot& params, const MacroController& macro) noexcept;
+    void selectOversampling(OversamplingFactor factor) noexcept;
     void processInternal(juce::AudioBuffer<float>& buffer) noexcept;
+    void processAdaptive(juce::AudioBuffer<float>& buffer) noexcept;
+    void processOversampled(juce::AudioBuffer<float>& buffer) noexcept;
+    void processShaper(juce::AudioBuffer<float>& buffer) noexcept;
+    void applyShaper(float* data, int numSamples, AdaaShaper::State& state) noexcept;
+    void applyPlainShaper(float* data, int numSamples) noexcept;
+    void primeOversampler() noexcept;
+    void writeShaperHistory(const juce::AudioBuffer<float>& buffer, int channels) noexcept;
+    void readShaperHistory(juce::AudioBuffer<float>& dest, int channels, int samplesBack, int numSamples) const noexcept;
     
-    float processTapeMode(float input) noexcept;
-    float processDiodeMode(float input) noexcept;
-    float processFoldMode(float input) noexcept;
+    template <DistortType type>
+    static void shapeBlock(float* data, int numSamples, float drive, float compensation) noexcept;
+    
+    // Antiderivative tables for each DistortType, built the first time any Distort is prepared
+    static const std::array<AdaaShaper, numShapers>& getAdaaShapers();
     
     void applyPreEmphasis(juce::AudioBuffer<float>& buffer) noexcept;
     void applyDeEmphasis(juce::AudioBuffer<float>& buffer) noexcept;
-    void applyToneShaping(juce::AudioBuffer<float>& buffer, bool isPreShaper) noexcept;
-    void applyBias(juce::AudioBuffer<float>& buffer) noexcept;
+    void applyToneShaping(juce::AudioBuffer<float>& buffer) noexcept;
     void removeDC(juce::AudioBuffer<float>& buffer) noexcept;
+    void clearFilterState() noexcept;
+    void clearDryDelay() noexcept;
 
     double sampleRate = 44100.0;
     int maxSamplesPerBlock = 512;
     int numChannels = 2;
     int latencySamples = 0;
+    int chainFactor = 1;
     bool bypassed = false;
 
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
-    juce::AudioBuffer<float> oversampledBuffer;
+    // One oversampler per factor above 1x, all built in prepare() so switching never allocates
+    std::array<HalfbandOversampler, numFactors> oversamplers;
+    std::array<int, numFactors> factorLatency {};
     juce::AudioBuffer<float> dryDelayBuffer;
     
-    juce::dsp::IIR::Filter<float> preEmphasisFilters[2];
-    juce::dsp::IIR::Filter<float> deEmphasisFilters[2];  
-    juce::dsp::IIR::Filter<float> toneFilters[2];
-    juce::dsp::IIR::Filter<float> dcBlockFilters[2];
+    // One of each per channel, sized in prepare()
+    std::vector<juce::dsp::IIR::Filter<float>> preEmphasisFilters;
+    std::vector<juce::dsp::IIR::Filter<float>> deEmphasisFilters;
+    std::vector<juce::dsp::IIR::Filter<float>> toneFilters;
+    std::vector<juce::dsp::IIR::Filter<float>> dcBlockFilters;
+    
+    // Tone shelf across the -1..+1 control at the host rate, designed in prepare()
+    BiquadTable toneTable;
+    juce::SmoothedValue<float> toneSmoothed;
+    
+    // ADAA history per channel, so 1x and 2x alias far less than the plain shapers would
+    std::vector<AdaaShaper::State> adaaStates;
+    const AdaaShaper* adaaShaper = nullptr;
+    int adaaOrder = 0;
+    
+    // Level-adaptive oversampling. The shaper input of the last few blocks is kept so the
+    // linear path can be delayed to the oversampler's latency, and so the oversampler can be
+    // primed from it before it takes over again.
+    juce::AudioBuffer<float> shaperHistory;
+    juce::AudioBuffer<float> linearPathBuffer;
+    juce::AudioBuffer<float> primeBuffer;
+    int shaperHistoryWritePos = 0;
+    int linearHoldSamples = 0;
+    int linearHoldRemaining = 0;
+    bool oversamplingEngaged = false;
     
     int dryDelayWritePos = 0;
+    TailTracker tailTracker;
+    int tailSamples = 0;
     
     DistortType currentType = DistortType::Tape;
     OversamplingFactor currentOS = OversamplingFactor::x2;
     float currentDrive = 1.0f;
-    float currentTone = 0.0f;
-    float currentBias = 0.0f;
     
     static constexpr float kMaxDriveGain = 15.85f;
     static constexpr float kDCBlockFreq = 5.0f;
     static constexpr float kPreEmphasisFreq = 3000.0f;
+    static constexpr double kSettleSeconds = 0.02; // Filter ring-out checked before sleeping
+    
+    // Shaper input peaks below which each DistortType is linear, or close enough that its
+    // harmonics stay under -55 dB: tape bends from the start, diode and fold have a knee
+    static constexpr std::array<float, numShapers> kLinearPeak { 0.05f, 0.4f, 0.8f };
+    static constexpr double kLinearHoldSeconds = 0.05; // Quiet time before oversampling stops
+    static constexpr int kPrimeSamples = 256; // History run through an oversampler before it takes over, longer than its filters
+    static constexpr int kCrossfadeSamples = 32; // Hand-over between the linear and oversampled paths
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Distort)
 };
 
-}
\ No newline at end of file
+template <>
+inline float Distort::shape<Distort::DistortType::Tape>(float input) noexcept
+{
+    // Tape saturation: a tanh-like curve with asymmetry
+    
+    // Add subtle asymmetry for tape character
+    const float asymmetry = 0.05f;
+    const float biased = input + asymmetry * input * input;
+    
+    // Padé approximation of tanh, smoother and less harsh than the real one
+    const float x = biased * 0.7f; // Scale for gentler saturation
+    const float x2 = x * x;
+    const float output = x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    
+    // Add subtle even harmonics for warmth
+    return output + 0.02f * output * output * (input > 0.0f ? 1.0f : -1.0f);
+}
+
+template <>
+inline float Distort::shape<Distort::DistortType::Diode>(float input) noexcept
+{
+    // Germanium-style diode clipping: linear up to a knee, then a tanh shoulder.
+    // The negative half has a lower knee and a steeper shoulder for asymmetry.
+    const float threshold = 0.5f; // Lower threshold for gentler clipping
+    const float softness = 0.8f; // Softer saturation curve
+    
+    const bool positive = input >= 0.0f;
+    const float knee = positive ? threshold : threshold * 0.8f;
+    const float steepness = positive ? softness : softness * 1.2f;
+    
+    const float magnitude = std::abs(input);
+    const float excess = positivePart(magnitude - knee);
+    const float shaped = (magnitude - excess) + (1.0f - knee) * fastTanh(excess * steepness);
+    
+    return std::copysign(shaped, input);
+}
+
+template <>
+inline float Distort::shape<Distort::DistortType::Fold>(float input) noexcept
+{
+    // Gentle wavefolder: linear below the threshold, then a soft triangle fold
+    // blended in with the original
+    const float foldThreshold = 0.8f; // High threshold - less folding
+    const float foldAmount = 0.3f; // Reduced intensity
+    const float maxBlend = 0.6f;
+    
+    const float excess = positivePart(std::abs(input) - foldThreshold);
+    
+    // Soft limit the folding to prevent extreme values
+    const float foldFloor = foldThreshold * 0.5f;
+    const float foldedExcess = foldFloor + positivePart(foldThreshold - excess * foldAmount - foldFloor);
+    const float folded = std::copysign(foldedExcess, input);
+    
+    // Blend original and folded for smoother transition; nothing folds below the threshold
+    const float blend = maxBlend - positivePart(maxBlend - excess * 2.0f);
+    return input * (1.0f - blend) + folded * blend;
+}
+
+}
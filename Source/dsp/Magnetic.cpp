@@ -1,24 +1,42 @@
 #include "Magnetic.h"
 #include "../core/Params.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 
 namespace ReallyCheap
 {
 
 Magnetic::Magnetic()
 {
-    random.setSeedRandomly();
 }
 
 void Magnetic::prepare(double sampleRate_, int blockSize, int numChannels_)
 {
-    juce::ignoreUnused(blockSize);
     sampleRate = sampleRate_;
     numChannels = numChannels_;
     
     channels.clear();
     channels.resize(numChannels);
     
+    // Channels are processed laneWidth at a time, one SIMD register per group
+    laneStates.clear();
+    laneStates.resize(static_cast<size_t>(getNumLaneGroups(numChannels)));
+    
+    // The one-pole coefficients were tuned per host-rate sample; chainFactor samples of
+    // pow(c, 1 / chainFactor) decay as far as one of c did
+    const double perSample = 1.0 / static_cast<double>(chainFactor);
+    attackCoeff = static_cast<float>(std::pow(0.9, perSample));
+    releaseCoeff = static_cast<float>(std::pow(0.9995, perSample));
+    envelopeCoeff = static_cast<float>(std::pow(0.99, perSample));
+    gainSmoothingCoeff = static_cast<float>(std::pow(0.999, perSample));
+    
+    crosstalkLength = 8 * chainFactor;
+    crosstalkDelaySamples = 4 * chainFactor;
+    
+    // White noise spreads over chainFactor times the bandwidth and the decimation keeps only
+    // the host band of it, so it needs sqrt(chainFactor) more amplitude to keep the same hiss
+    hissScale = static_cast<float>(std::sqrt(static_cast<double>(chainFactor)));
+    
     // Setup parameter smoothing (30ms)
     const double smoothingTime = 0.03;
     smoothedCompAmount.reset(sampleRate, smoothingTime);
@@ -27,48 +45,79 @@ void Magnetic::prepare(double sampleRate_, int blockSize, int numChannels_)
     smoothedHeadBump.reset(sampleRate, smoothingTime);
     smoothedWear.reset(sampleRate, smoothingTime);
     
-    // Initialize per-channel filters
-    for (auto& channel : channels)
+    // Head bump: Low-shelf at the bump frequency, Q=0.7
+    // headBumpFreq comes as 40-120 Hz from parameter; higher frequency = more gain,
+    // 40Hz = 0dB, 120Hz = +12dB - much more obvious
+    headBumpTable.prepare(40.0f, 120.0f, [this] (float frequency)
+    {
+        const float gainDb = juce::jlimit(0.0f, 12.0f, (frequency - 40.0f) / (120.0f - 40.0f) * 12.0f);
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeLowShelf(
+            sampleRate, frequency, 0.7f, juce::Decibels::decibelsToGain(gainDb));
+    });
+    
+    // Wear: map wear amount to cutoff frequency: 20kHz (no wear) to 3kHz (max wear) - very dramatic,
+    // kept clear of Nyquist
+    wearTable.prepare(0.0f, 1.0f, [this] (float wearAmount)
     {
+        float cutoffHz = juce::jlimit(3000.0f, 20000.0f, 20000.0f - wearAmount * 17000.0f);
+        cutoffHz = juce::jmin(cutoffHz, static_cast<float>(sampleRate * 0.45));
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, cutoffHz);
+    });
+    
+    // Hysteresis aliases badly at the host rate, so without a shared chain it gets a 2x of its own
+    saturationDomain.prepare(numChannels, blockSize, chainFactor == 1 ? 2 : 1);
+    const double hysteresisRate = sampleRate * saturationDomain.getFactor();
+    
+    for (auto& state : laneStates)
+        state.hysteresis.prepare(hysteresisRate);
+    
+    // Emphasis filters for each saturation mode's rate
+    auto makeEmphasis = [] (double rate)
+    {
+        EmphasisCoefficients emphasis;
+        
         // Pre-emphasis: +6dB/oct above 2kHz for saturation clarity
-        auto preEmphCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            sampleRate, 2000.0f, 0.707f, juce::Decibels::decibelsToGain(6.0f));
-        channel.preEmphasisFilter.coefficients = preEmphCoeffs;
+        emphasis.pre = juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf(
+            rate, 2000.0f, 0.707f, juce::Decibels::decibelsToGain(6.0f));
         
         // De-emphasis: -6dB/oct above 2kHz to restore balance
-        auto deEmphCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            sampleRate, 2000.0f, 0.707f, juce::Decibels::decibelsToGain(-6.0f));
-        channel.deEmphasisFilter.coefficients = deEmphCoeffs;
-        
-        // Head bump: Low-shelf at 80Hz, Q=0.7
-        auto headBumpCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-            sampleRate, 80.0f, 0.7f, 1.0f); // Gain will be updated per-sample
-        channel.headBumpFilter.coefficients = headBumpCoeffs;
+        emphasis.de = juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf(
+            rate, 2000.0f, 0.707f, juce::Decibels::decibelsToGain(-6.0f));
         
-        // Wear: Low-pass starting at 20kHz (will be updated)
-        auto wearCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            sampleRate, 20000.0f);
-        channel.wearFilter.coefficients = wearCoeffs;
-    }
+        return emphasis;
+    };
+    
+    tanhEmphasis = makeEmphasis(sampleRate);
+    hysteresisEmphasis = makeEmphasis(hysteresisRate);
+    
+    // Initialize per-group filters
+    setHysteresisOn(hysteresisOn);
     
     reset();
 }
 
 void Magnetic::reset()
 {
-    for (auto& channel : channels)
+    for (auto& state : laneStates)
     {
         // Reset compression envelope
-        channel.compEnvState1 = 0.0f;
-        channel.compEnvState2 = 0.0f;
-        channel.lastGainReduction = 0.0f;
+        state.compEnvState1 = LaneVector(0.0f);
+        state.compEnvState2 = LaneVector(0.0f);
+        state.lastGainReduction = LaneVector(0.0f);
         
         // Reset all filters
-        channel.preEmphasisFilter.reset();
-        channel.deEmphasisFilter.reset();
-        channel.headBumpFilter.reset();
-        channel.wearFilter.reset();
+        state.preEmphasisFilter.reset();
+        state.deEmphasisFilter.reset();
+        state.headBumpFilter.reset();
+        state.wearFilter.reset();
         
+        state.hysteresis.reset();
+    }
+    
+    saturationDomain.reset();
+    
+    for (auto& channel : channels)
+    {
         // Clear crosstalk delay
         std::fill(channel.crosstalkDelay.begin(), channel.crosstalkDelay.end(), 0.0f);
         channel.crosstalkWritePos = 0;
@@ -84,7 +133,7 @@ void Magnetic::reset()
 
 void Magnetic::process(juce::AudioBuffer<float>& buffer, 
                       juce::AudioPlayHead* playHead, 
-                      juce::AudioProcessorValueTreeState& apvts,
+                      const ParamSnapshot& params,
                       const MacroController& macro) noexcept
 {
     juce::ignoreUnused(playHead);
@@ -93,19 +142,30 @@ void Magnetic::process(juce::AudioBuffer<float>& buffer,
     const int bufferChannels = buffer.getNumChannels();
     
     // Get parameters
-    const bool magOn = *apvts.getRawParameterValue(ParameterIDs::magOn) > 0.5f;
+    const bool magOn = params.magOn;
     
     if (!magOn)
+    {
+        // Lets the local 2x know it sat this block out, so it restarts clean
+        saturationDomain.process(buffer, false, [] (juce::AudioBuffer<float>&) {});
         return;
+    }
     
-    const float baseCompAmount = *apvts.getRawParameterValue(ParameterIDs::magComp);
-    const float baseSatAmount = *apvts.getRawParameterValue(ParameterIDs::magSat);
-    const float crosstalk = *apvts.getRawParameterValue(ParameterIDs::magCrosstalk);
-    const float headBump = *apvts.getRawParameterValue(ParameterIDs::magHeadBumpHz);
-    const float wear = *apvts.getRawParameterValue(ParameterIDs::magWear);
+    const float baseCompAmount = params.magComp;
+    const float baseSatAmount = params.magSat;
+    const float crosstalk = params.magCrosstalk;
+    const float headBump = params.magHeadBumpHz;
+    const float wear = params.magWear;
+    
+    // The emphasis filters and their rate follow the saturation mode
+    const bool useHysteresis = params.magSatMode == 1;
+    if (useHysteresis != hysteresisOn)
+        setHysteresisOn(useHysteresis);
+    
+    hysteresisSolver = static_cast<HysteresisSolver>(juce::jlimit(0, 3, params.magHysteresisQuality));
     
     // Generate hiss level based on wear amount (comprehensive aging control)
-    const float hissLevel = wear * wear * 0.15f; // Quadratic scaling for more realistic aging
+    const float hissLevel = wear * wear * 0.15f * hissScale; // Quadratic scaling for more realistic aging
     
     // Apply macro modulation with guardrails
     const float compAmount = baseCompAmount * macro.magneticCompGain();
@@ -118,222 +178,289 @@ void Magnetic::process(juce::AudioBuffer<float>& buffer,
     smoothedHeadBump.setTargetValue(headBump);
     smoothedWear.setTargetValue(wear);
     
-    // Process each channel
-    for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(channels.size())); ++ch)
+    // Channels advance together, laneWidth per SIMD register; the smoothed
+    // parameters are shared, so they step once per sample
+    const int activeChannels = std::min(bufferChannels, static_cast<int>(laneStates.size()) * laneWidth);
+    const int numGroups = getNumLaneGroups(activeChannels);
+    
+    LaneGroup groups[maxLaneGroups];
+    for (int group = 0; group < numGroups; ++group)
+        groups[group] = LaneGroup(buffer, group, activeChannels);
+    
+    // The whole block's hiss noise in one draw, laid out sample by sample
+    jassert(scratchArena != nullptr && blockRandom != nullptr);
+    if (scratchArena == nullptr)
+        return;
+    
+    ScratchArena::Scope scratchScope(*scratchArena);
+    float* hissNoise = (hissLevel > 0.0f && blockRandom != nullptr) ? scratchArena->getFloats(numSamples * activeChannels)
+                                                                     : nullptr;
+    if (hissNoise != nullptr)
+        blockRandom->fillUniform(hissNoise, numSamples * activeChannels);
+    
+    // Saturation may run at another rate, so the stages go over the block one after another,
+    // with the smoothed saturation kept for the second
+    float* satAmounts = scratchArena->getFloats(numSamples);
+    if (satAmounts == nullptr)
+        return;
+    
+    for (int sample = 0; sample < numSamples; ++sample)
     {
-        auto& channel = channels[ch];
-        auto* channelData = buffer.getWritePointer(ch);
+        const float currentCompAmount = smoothedCompAmount.getNextValue();
+        satAmounts[sample] = smoothedSatAmount.getNextValue();
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        // 1. COMPRESSION - Level-dependent gain reduction
+        for (int group = 0; group < numGroups; ++group)
+            groups[group].store(sample, processCompression(laneStates[static_cast<size_t>(group)],
+                                                           groups[group].load(sample), currentCompAmount));
+    }
+    
+    // 2. SATURATION - Tape-like soft clipping with pre/de-emphasis, at 2x for the hysteresis
+    // unless the chain is already oversampled
+    saturationDomain.process(buffer, hysteresisOn, [this, satAmounts, numSamples, activeChannels] (juce::AudioBuffer<float>& block)
+    {
+        saturateBlock(block, satAmounts, numSamples, activeChannels);
+    });
+    
+    for (int sample = 0; sample < numSamples; ++sample)
+    {
+        // Get smoothed parameter values
+        const float currentHeadBump = smoothedHeadBump.getNextValue();
+        const float currentWear = smoothedWear.getNextValue();
+        
+        // Filter responses follow the smoothed controls one sub-block at a time
+        if (sample % BiquadTable::subBlockSize == 0)
+            updateToneFilters(currentHeadBump, currentWear);
+        
+        for (int group = 0; group < numGroups; ++group)
         {
-            float input = channelData[sample];
-            float output = input;
-            
-            // Get smoothed parameter values
-            const float currentCompAmount = smoothedCompAmount.getNextValue();
-            const float currentSatAmount = smoothedSatAmount.getNextValue();
-            const float currentHeadBump = smoothedHeadBump.getNextValue();
-            const float currentWear = smoothedWear.getNextValue();
-            
-            // 1. COMPRESSION - Level-dependent gain reduction
-            output = processCompression(channel, output, currentCompAmount);
-            
-            // 2. SATURATION - Tape-like soft clipping with pre/de-emphasis
-            output = processSaturation(channel, output, currentSatAmount);
+            auto& state = laneStates[static_cast<size_t>(group)];
+            auto output = groups[group].load(sample);
             
             // 3. HEAD BUMP - Low-shelf boost around 80Hz
-            if (sample == 0) // Only update filter coefficients once per block
-                updateHeadBumpFilter(channel, currentHeadBump);
-            output = channel.headBumpFilter.processSample(output);
+            output = state.headBumpFilter.processSample(output);
             
             // 4. WEAR - Gentle HF rolloff  
-            if (sample == 0) // Only update filter coefficients once per block
-                updateWearFilter(channel, currentWear);
-            output = channel.wearFilter.processSample(output);
+            output = state.wearFilter.processSample(output);
             
             // 5. HISS - Tape aging noise (integrated with wear control)
-            if (hissLevel > 0.0f)
-            {
-                // Generate pink-ish noise for realistic tape hiss
-                float whiteNoise = (random.nextFloat() - 0.5f) * 2.0f;
-                float hissNoise = whiteNoise * hissLevel * 0.02f; // Scale to reasonable level
-                
-                // High-pass filter the hiss to simulate tape characteristics
-                if (ch == 0) // Only filter once per sample 
-                {
-                    // Simple high-pass to emphasize high frequencies like real tape hiss
-                    hissNoise *= (1.0f + currentWear * 0.5f); // More emphasis with more wear
-                }
-                
-                output += hissNoise;
-            }
+            if (hissNoise != nullptr)
+                output += generateHiss(hissNoise + sample * activeChannels, groups[group].getFirstChannel(),
+                                       groups[group].getNumLanes(), hissLevel, currentWear);
             
             // Safety check for NaN/Inf
-            if (!std::isfinite(output))
-                output = 0.0f;
-                
-            channelData[sample] = output;
+            output = output & isFinite(output);
+            
+            groups[group].store(sample, output);
         }
     }
     
-    // 6. CROSSTALK - Apply stereo bleed between channels (post-processing)
+    // 6. CROSSTALK - Apply bleed between the channels of each pair (post-processing)
     // Note: Using the final smoothed value for the entire buffer for crosstalk
     const float finalCrosstalk = smoothedCrosstalk.getCurrentValue();
     applyCrosstalk(buffer, finalCrosstalk);
 }
 
-float Magnetic::processCompression(ChannelState& channel, float input, float compAmount) noexcept
+LaneVector Magnetic::processCompression(LaneState& state, LaneVector input, float compAmount) noexcept
 {
     if (compAmount <= 0.0f)
         return input;
     
     // RMS-style envelope following with 2-pole smoothing
-    float inputLevel = std::abs(input);
+    const auto inputLevel = LaneVector::abs(input);
     
     // Faster attack, slower release for more pumping character
-    float alpha1 = inputLevel > channel.compEnvState1 ? 0.9f : 0.9995f; // Faster attack, slower release
-    channel.compEnvState1 = alpha1 * channel.compEnvState1 + (1.0f - alpha1) * inputLevel;
+    const auto alpha1 = select(LaneVector::greaterThan(inputLevel, state.compEnvState1),
+                               LaneVector(attackCoeff), LaneVector(releaseCoeff)); // Faster attack, slower release
+    state.compEnvState1 = alpha1 * state.compEnvState1 + (LaneVector(1.0f) - alpha1) * inputLevel;
     
     // Less smoothing for more obvious compression artifacts
-    float alpha2 = 0.99f; // Less smoothing for more character
-    channel.compEnvState2 = alpha2 * channel.compEnvState2 + (1.0f - alpha2) * channel.compEnvState1;
+    const float alpha2 = envelopeCoeff; // Less smoothing for more character
+    state.compEnvState2 = state.compEnvState2 * alpha2 + state.compEnvState1 * (1.0f - alpha2);
     
     // EXTREMELY aggressive compression curve for maximum in-your-face effect
-    float level = channel.compEnvState2;
-    float threshold = 0.05f - compAmount * 0.048f; // Even lower threshold (0.05 to 0.002)
-    float ratio = 6.0f + compAmount * 24.0f; // 6:1 to 30:1 ratio - brutally extreme compression
+    const auto level = state.compEnvState2;
+    const float threshold = 0.05f - compAmount * 0.048f; // Even lower threshold (0.05 to 0.002)
+    const float ratio = 6.0f + compAmount * 24.0f; // 6:1 to 30:1 ratio - brutally extreme compression
     
-    float gainReduction = 0.0f;
-    if (level > threshold)
-    {
-        float overThreshold = level - threshold;
-        float compressedOver = overThreshold / ratio;
-        gainReduction = overThreshold - compressedOver;
-        
-        // Allow extreme gain reduction for maximum pumping effect
-        gainReduction = juce::jmin(gainReduction, 0.95f); // ~26dB max reduction
-    }
+    // Above the threshold, take out all but 1/ratio of the overshoot
+    const auto overThreshold = level - threshold;
+    auto gainReduction = overThreshold - overThreshold * (1.0f / ratio);
+    
+    // Allow extreme gain reduction for maximum pumping effect
+    gainReduction = LaneVector::min(gainReduction, LaneVector(0.95f)); // ~26dB max reduction
+    gainReduction = gainReduction & LaneVector::greaterThan(level, LaneVector(threshold));
     
     // Scale the effect based on compAmount for more control
     gainReduction *= compAmount;
     
     // Less smoothing for more obvious compression pumping
-    float smoothingCoeff = 0.999f; // Less smoothing for more aggressive character
-    channel.lastGainReduction = smoothingCoeff * channel.lastGainReduction + 
-                               (1.0f - smoothingCoeff) * gainReduction;
+    const float smoothingCoeff = gainSmoothingCoeff; // Less smoothing for more aggressive character
+    state.lastGainReduction = state.lastGainReduction * smoothingCoeff + gainReduction * (1.0f - smoothingCoeff);
     
-    float compressionGain = 1.0f - channel.lastGainReduction;
+    const auto compressionGain = LaneVector(1.0f) - state.lastGainReduction;
     // Add aggressive makeup gain for more presence
-    float makeupGain = 1.0f + (channel.lastGainReduction * 1.2f); // Restore 120% of reduced gain for more punch
-    float result = input * compressionGain * makeupGain;
+    const auto makeupGain = state.lastGainReduction * 1.2f + 1.0f; // Restore 120% of reduced gain for more punch
+    const auto result = input * compressionGain * makeupGain;
     
     // Safety check
-    if (!std::isfinite(result))
-        return input;
-        
-    return result;
+    return select(isFinite(result), result, input);
 }
 
-float Magnetic::processSaturation(ChannelState& channel, float input, float satAmount) noexcept
+LaneVector Magnetic::processSaturation(LaneState& state, LaneVector input, float satAmount) noexcept
 {
     if (satAmount <= 0.0f)
         return input;
     
     // Pre-emphasis for clarity during saturation
-    float preEmphasized = channel.preEmphasisFilter.processSample(input);
+    const auto preEmphasized = state.preEmphasisFilter.processSample(input);
     
     // Much more drive for obvious saturation
-    float drive = 1.0f + satAmount * 9.0f; // Up to 10x drive
-    float driven = preEmphasized * drive;
+    const float drive = 1.0f + satAmount * 9.0f; // Up to 10x drive
+    const auto driven = preEmphasized * (drive * 0.7f);
     
-    // Soft saturation using tanh
-    float saturated = std::tanh(driven * 0.7f) / 0.7f; // Normalized tanh
+    LaneVector saturated;
+    
+    if (hysteresisOn)
+    {
+        // Magnetisation tops out at 1, scaled to the same ceiling as the tanh curve
+        saturated = state.hysteresis.processSample(driven, hysteresisSolver) * (1.0f / 0.7f);
+    }
+    else
+    {
+        // Soft saturation using tanh, lane by lane
+        alignas(sizeof(LaneVector)) float lanes[laneWidth];
+        driven.copyToRawArray(lanes);
+        for (auto& x : lanes)
+            x = std::tanh(x) / 0.7f; // Normalized tanh
+        
+        saturated = LaneVector::fromRawArray(lanes);
+    }
     
     // Mix with clean signal for subtle effect
-    float mixed = input + satAmount * (saturated - input);
+    const auto mixed = input + (saturated - input) * satAmount;
     
     // De-emphasis to restore frequency balance
-    float result = channel.deEmphasisFilter.processSample(mixed);
+    const auto result = state.deEmphasisFilter.processSample(mixed);
     
     // Safety check
-    if (!std::isfinite(result))
-        return input;
-        
-    return result;
+    return select(isFinite(result), result, input);
 }
 
-void Magnetic::applyCrosstalk(juce::AudioBuffer<float>& buffer, float crosstalkAmount) noexcept
+void Magnetic::saturateBlock(juce::AudioBuffer<float>& block, const float* satAmounts, int numSamples, int activeChannels) noexcept
 {
-    if (crosstalkAmount <= 0.0f || buffer.getNumChannels() < 2)
-        return;
+    // block is numSamples long, or a whole number of times that inside the local 2x
+    const int oversampling = juce::jmax(1, block.getNumSamples() / juce::jmax(1, numSamples));
+    const int numGroups = getNumLaneGroups(activeChannels);
     
-    const int numSamples = buffer.getNumSamples();
-    auto* leftData = buffer.getWritePointer(0);
-    auto* rightData = buffer.getWritePointer(1);
+    LaneGroup groups[maxLaneGroups];
+    for (int group = 0; group < numGroups; ++group)
+        groups[group] = LaneGroup(block, group, activeChannels);
     
-    // Scale crosstalk amount (0-40% max) - very obvious effect
-    float bleedAmount = crosstalkAmount * 0.4f;
-    
-    for (int sample = 0; sample < numSamples; ++sample)
+    for (int sample = 0; sample < block.getNumSamples(); ++sample)
     {
-        float leftSample = leftData[sample];
-        float rightSample = rightData[sample];
-        
-        // Add small delay for more realistic tape crosstalk
-        auto& leftChannel = channels[0];
-        auto& rightChannel = channels[1];
-        
-        // Store current samples in delay buffers
-        leftChannel.crosstalkDelay[leftChannel.crosstalkWritePos] = leftSample;
-        rightChannel.crosstalkDelay[rightChannel.crosstalkWritePos] = rightSample;
+        const float currentSatAmount = satAmounts[sample / oversampling];
         
-        // Get slightly delayed samples for crosstalk
-        int readPos = (leftChannel.crosstalkWritePos + 4) % 8; // ~0.1ms delay at 44.1kHz
-        float delayedLeft = leftChannel.crosstalkDelay[readPos];
-        float delayedRight = rightChannel.crosstalkDelay[readPos];
-        
-        // Apply crosstalk bleed
-        leftData[sample] = leftSample + bleedAmount * delayedRight;
-        rightData[sample] = rightSample + bleedAmount * delayedLeft;
-        
-        // Advance write positions
-        leftChannel.crosstalkWritePos = (leftChannel.crosstalkWritePos + 1) % 8;
-        rightChannel.crosstalkWritePos = (rightChannel.crosstalkWritePos + 1) % 8;
+        for (int group = 0; group < numGroups; ++group)
+            groups[group].store(sample, processSaturation(laneStates[static_cast<size_t>(group)],
+                                                          groups[group].load(sample), currentSatAmount));
     }
 }
 
-void Magnetic::updateHeadBumpFilter(ChannelState& channel, float headBumpFreq)
+void Magnetic::setHysteresisOn(bool shouldBeOn) noexcept
 {
-    // headBumpFreq comes as 40-120 Hz from parameter
-    float frequency = juce::jlimit(40.0f, 120.0f, headBumpFreq);
+    hysteresisOn = shouldBeOn;
+    const auto& emphasis = hysteresisOn ? hysteresisEmphasis : tanhEmphasis;
     
-    // Map frequency to gain: higher frequency = more gain
-    // 40Hz = 0dB, 120Hz = +12dB - much more obvious  
-    float gainDb = (frequency - 40.0f) / (120.0f - 40.0f) * 12.0f;
-    gainDb = juce::jlimit(0.0f, 12.0f, gainDb);
-    float linearGain = juce::Decibels::decibelsToGain(gainDb);
+    // The filters' history and the magnetisation belong to the other mode
+    for (auto& state : laneStates)
+    {
+        state.preEmphasisFilter.setCoefficients(emphasis.pre);
+        state.deEmphasisFilter.setCoefficients(emphasis.de);
+        state.preEmphasisFilter.reset();
+        state.deEmphasisFilter.reset();
+        state.hysteresis.reset();
+    }
+}
+
+LaneVector Magnetic::generateHiss(const float* noise, int firstChannel, int numLanes, float hissLevel, float wear) noexcept
+{
+    alignas(sizeof(LaneVector)) float hiss[laneWidth] = {};
     
-    auto coeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-        sampleRate, frequency, 0.7f, linearGain);
+    for (int lane = 0; lane < numLanes; ++lane)
+    {
+        // Generate pink-ish noise for realistic tape hiss
+        float whiteNoise = noise[firstChannel + lane];
+        hiss[lane] = whiteNoise * hissLevel * 0.02f; // Scale to reasonable level
+        
+        // High-pass filter the hiss to simulate tape characteristics
+        if (firstChannel + lane == 0) // Only filter once per sample 
+        {
+            // Simple high-pass to emphasize high frequencies like real tape hiss
+            hiss[lane] *= (1.0f + wear * 0.5f); // More emphasis with more wear
+        }
+    }
     
-    if (coeffs != nullptr)
-        channel.headBumpFilter.coefficients = coeffs;
+    return LaneVector::fromRawArray(hiss);
 }
 
-void Magnetic::updateWearFilter(ChannelState& channel, float wearAmount)
+void Magnetic::applyCrosstalk(juce::AudioBuffer<float>& buffer, float crosstalkAmount) noexcept
 {
-    // Map wear amount to cutoff frequency: 20kHz (no wear) to 3kHz (max wear) - very dramatic
-    float cutoffHz = 20000.0f - wearAmount * 17000.0f;
-    cutoffHz = juce::jlimit(3000.0f, 20000.0f, cutoffHz);
+    if (crosstalkAmount <= 0.0f)
+        return;
     
-    // Don't update if cutoff is too close to Nyquist
-    if (cutoffHz > sampleRate * 0.45)
-        cutoffHz = static_cast<float>(sampleRate * 0.45);
+    const int numSamples = buffer.getNumSamples();
+    const int availableChannels = juce::jmin(buffer.getNumChannels(), static_cast<int>(channels.size()));
     
-    auto coeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, cutoffHz);
+    // Scale crosstalk amount (0-40% max) - very obvious effect
+    float bleedAmount = crosstalkAmount * 0.4f;
     
-    if (coeffs != nullptr)
-        channel.wearFilter.coefficients = coeffs;
+    // Tape tracks only bleed into their neighbour, so each pair is independent
+    for (const auto& pair : channelPairs)
+    {
+        if (pair.right >= availableChannels)
+            continue;
+        
+        auto* leftData = buffer.getWritePointer(pair.left);
+        auto* rightData = buffer.getWritePointer(pair.right);
+        auto& leftChannel = channels[pair.left];
+        auto& rightChannel = channels[pair.right];
+        
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            float leftSample = leftData[sample];
+            float rightSample = rightData[sample];
+            
+            // Store current samples in delay buffers
+            leftChannel.crosstalkDelay[leftChannel.crosstalkWritePos] = leftSample;
+            rightChannel.crosstalkDelay[rightChannel.crosstalkWritePos] = rightSample;
+            
+            // Get slightly delayed samples for crosstalk
+            int readPos = (leftChannel.crosstalkWritePos + crosstalkLength - crosstalkDelaySamples) % crosstalkLength; // ~0.1ms delay at 44.1kHz
+            float delayedLeft = leftChannel.crosstalkDelay[readPos];
+            float delayedRight = rightChannel.crosstalkDelay[readPos];
+            
+            // Apply crosstalk bleed
+            leftData[sample] = leftSample + bleedAmount * delayedRight;
+            rightData[sample] = rightSample + bleedAmount * delayedLeft;
+            
+            // Advance write positions
+            leftChannel.crosstalkWritePos = (leftChannel.crosstalkWritePos + 1) % crosstalkLength;
+            rightChannel.crosstalkWritePos = (rightChannel.crosstalkWritePos + 1) % crosstalkLength;
+        }
+    }
+}
+
+void Magnetic::updateToneFilters(float headBumpFreq, float wearAmount) noexcept
+{
+    // Table lookups, and only for a control that has moved since the last sub-block
+    if (headBumpTable.update(headBumpFreq))
+        for (auto& state : laneStates)
+            state.headBumpFilter.setCoefficients(headBumpTable.getCurrent());
+    
+    if (wearTable.update(wearAmount))
+        for (auto& state : laneStates)
+            state.wearFilter.setCoefficients(wearTable.getCurrent());
 }
 
 float Magnetic::softClip(float input) noexcept
@@ -1,12 +1,20 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../core/ScratchArena.h"
+#include "../core/BlockRandom.h"
+#include "shared/ChannelPairs.h"
+#include "shared/ChannelLanes.h"
+#include "shared/BiquadTable.h"
+#include "shared/JilesAtherton.h"
+#include "shared/OversampledDomain.h"
 
 namespace ReallyCheap
 {
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 class Magnetic
 {
@@ -18,37 +26,96 @@ public:
     void reset();
     void process(juce::AudioBuffer<float>& buffer, 
                  juce::AudioPlayHead* playHead, 
-                 juce::AudioProcessorValueTreeState& apvts,
+                 const ParamSnapshot& params,
                  const MacroController& macro) noexcept;
+    
+    // Crosstalk bleeds between the channels of each pair
+    void setChannelPairs(const ChannelPairs& pairs) noexcept { channelPairs = pairs; }
+    
+    // The hiss noise block is taken from this arena; it must outlive the module
+    void setScratchArena(ScratchArena& arena) noexcept { scratchArena = &arena; }
+    
+    // Hiss is drawn from this generator; it must outlive the module
+    void setBlockRandom(BlockRandom& generator) noexcept { blockRandom = &generator; }
+    
+    // Prepared at factor times the host rate inside a shared oversampled chain. The envelopes,
+    // crosstalk delay and hiss level are scaled so it sounds the same as at the host rate.
+    // Call before prepare().
+    void setChainOversampling(int factor) noexcept { chainFactor = juce::jlimit(1, maxChainFactor, factor); }
+    
+    // Host samples added by the local 2x the hysteresis runs at when there is no shared chain;
+    // counts only while the hysteresis saturation is selected
+    int getLatencySamples() const noexcept { return saturationDomain.getLatencySamples(); }
+    
+    // Delays the unprocessed signal to match while the local 2x is running
+    void alignDryPath(juce::AudioBuffer<float>& dryBuffer) noexcept { saturationDomain.alignDryPath(dryBuffer); }
 
 private:
+    static constexpr int maxChainFactor = 4;
+    
     // Core state
     double sampleRate = 44100.0;
     int numChannels = 2;
+    int chainFactor = 1;
+    ChannelPairs channelPairs;
+    ScratchArena* scratchArena = nullptr;
+    BlockRandom* blockRandom = nullptr;
     
-    // Per-channel processing state
-    struct ChannelState
+    // Processing state for a group of channels sharing a SIMD register
+    struct LaneState
     {
         // Compression envelope follower (2-pole)
-        float compEnvState1 = 0.0f;
-        float compEnvState2 = 0.0f;
-        float lastGainReduction = 0.0f;
+        LaneVector compEnvState1 { 0.0f };
+        LaneVector compEnvState2 { 0.0f };
+        LaneVector lastGainReduction { 0.0f };
         
         // Pre-emphasis/de-emphasis filters for saturation
-        juce::dsp::IIR::Filter<float> preEmphasisFilter;
-        juce::dsp::IIR::Filter<float> deEmphasisFilter;
+        LaneBiquad preEmphasisFilter;
+        LaneBiquad deEmphasisFilter;
+        
+        // Magnetisation for the hysteresis saturation
+        JilesAtherton hysteresis;
         
         // Head bump low-shelf filter
-        juce::dsp::IIR::Filter<float> headBumpFilter;
+        LaneBiquad headBumpFilter;
         
         // Wear high-frequency rolloff filter
-        juce::dsp::IIR::Filter<float> wearFilter;
-        
-        // Crosstalk delay for stereo bleed
-        std::array<float, 8> crosstalkDelay = {}; // Small delay buffer
+        LaneBiquad wearFilter;
+    };
+    
+    // Per-channel state for the crosstalk, which works on pairs rather than groups
+    struct ChannelState
+    {
+        // Crosstalk delay for bleed into the other channel of the pair
+        std::array<float, 8 * maxChainFactor> crosstalkDelay = {}; // Small delay buffer
         int crosstalkWritePos = 0;
     };
     
+    // Per-sample coefficients at the host rate, raised to 1/chainFactor in prepare()
+    float attackCoeff = 0.9f;
+    float releaseCoeff = 0.9995f;
+    float envelopeCoeff = 0.99f;
+    float gainSmoothingCoeff = 0.999f;
+    int crosstalkLength = 8;
+    int crosstalkDelaySamples = 4;
+    float hissScale = 1.0f;
+    
+    std::vector<LaneState> laneStates;
+    
+    // The hysteresis saturation runs at 2x on its own when the chain is at the host rate, and
+    // straight at the chain's rate otherwise; the tanh curve always runs at the module's rate
+    OversampledDomain saturationDomain;
+    bool hysteresisOn = false;
+    HysteresisSolver hysteresisSolver = HysteresisSolver::rk2;
+    
+    // Emphasis filters for the rate each saturation mode runs at
+    struct EmphasisCoefficients
+    {
+        std::array<float, 6> pre {};
+        std::array<float, 6> de {};
+    };
+    EmphasisCoefficients tanhEmphasis;
+    EmphasisCoefficients hysteresisEmphasis;
     std::vector<ChannelState> channels;
     
     // Parameter smoothing
@@ -58,15 +125,18 @@ private:
     juce::SmoothedValue<float> smoothedHeadBump;
     juce::SmoothedValue<float> smoothedWear;
     
-    // Hiss generation
-    juce::Random random;
+    // Head bump and wear responses, designed in prepare() over each control's range
+    BiquadTable headBumpTable;
+    BiquadTable wearTable;
     
     // Internal methods
-    float processCompression(ChannelState& channel, float input, float compAmount) noexcept;
-    float processSaturation(ChannelState& channel, float input, float satAmount) noexcept;
+    LaneVector processCompression(LaneState& state, LaneVector input, float compAmount) noexcept;
+    LaneVector processSaturation(LaneState& state, LaneVector input, float satAmount) noexcept;
+    void saturateBlock(juce::AudioBuffer<float>& block, const float* satAmounts, int numSamples, int activeChannels) noexcept;
+    void setHysteresisOn(bool shouldBeOn) noexcept;
+    LaneVector generateHiss(const float* noise, int firstChannel, int numLanes, float hissLevel, float wear) noexcept;
     void applyCrosstalk(juce::AudioBuffer<float>& buffer, float crosstalkAmount) noexcept;
-    void updateHeadBumpFilter(ChannelState& channel, float headBumpAmount);
-    void updateWearFilter(ChannelState& channel, float wearAmount);
+    void updateToneFilters(float headBumpFreq, float wearAmount) noexcept;
     float softClip(float input) noexcept;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Magnetic)
@@ -1,6 +1,7 @@
 #include "Noise.h"
 #include "../core/Params.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 
 namespace ReallyCheap
 {
@@ -40,33 +41,43 @@ void Noise::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
     widthSmoothed.reset(sampleRate, smoothTime);
     flutterGateSmoothed.reset(sampleRate, smoothTime * 3); // Slower for gate
     
-    // Setup age filters
-    ageFilters.clear();
-    ageFilters.resize(numChannels);
+    // Map age 0..1 to filter parameters
+    // HPF: 20Hz -> 120Hz
+    // LPF: 20kHz -> 6kHz  
+    // Mid dip: 0dB -> -6dB (bell at 2kHz, Q=0.5)
+    ageHighpassTable.prepare(0.0f, 1.0f, [this] (float ageAmount)
+    {
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(sampleRate, 20.0f + ageAmount * 100.0f);
+    });
     
-    for (auto& filter : ageFilters)
+    ageLowpassTable.prepare(0.0f, 1.0f, [this] (float ageAmount)
     {
-        // Initialize with neutral settings
-        auto hpCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 20.0f);
-        filter.highpass.coefficients = hpCoeffs;
-        
-        auto lpCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, 20000.0f);
-        filter.lowpass.coefficients = lpCoeffs;
-        
-        // Mid dip for aged sound (bell at 2kHz, Q=0.5, -3dB)
-        auto midCoeffs = juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            sampleRate, 2000.0f, 0.5f, juce::Decibels::decibelsToGain(-3.0f));
-        filter.midDip.coefficients = midCoeffs;
-    }
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, 20000.0f - ageAmount * 14000.0f);
+    });
+    
+    ageMidDipTable.prepare(0.0f, 1.0f, [this] (float ageAmount)
+    {
+        return juce::dsp::IIR::ArrayCoefficients<float>::makePeakFilter(
+            sampleRate, 2000.0f, 0.5f, juce::Decibels::decibelsToGain(-ageAmount * 6.0f));
+    });
+    
+    // Setup age filters, one set per group of channels sharing a SIMD register;
+    // their coefficients arrive with the first updateAgeFilters()
+    ageFilters.clear();
+    ageFilters.resize(static_cast<size_t>(getNumLaneGroups(numChannels)));
     
     reset();
 }
 
 void Noise::reset()
 {
-    for (auto& state : grainStates)
+    for (int ch = 0; ch < static_cast<int>(grainStates.size()); ++ch)
     {
-        state.readPosition = 0.0;
+        auto& state = grainStates[ch];
+        
+        // Both channels of a pair start together; each pair starts at its own point in the asset
+        const int leadChannel = channelPairs.isRightOfPair(ch) ? channelPairs.getPartner(ch) : ch;
+        state.readPosition = leadChannel * leadChannelOffsetSamples;
         // Reset other state variables (not needed for simple looping but keep for compatibility)
         state.grainPhase = 0.0f;
         state.inCrossfade = false;
@@ -85,6 +96,7 @@ void Noise::reset()
     flutterGate.gateCoeff = 1.0f;
     
     proceduralGen->reset();
+    smoothersInitialized = false;
     
     // NOTE: Don't initialize smoothers here - they will be initialized on first process() call
     // with actual parameter values from APVTS
@@ -92,7 +104,7 @@ void Noise::reset()
 
 void Noise::process(juce::AudioBuffer<float>& buffer,
                    juce::AudioPlayHead* playHead,
-                   juce::AudioProcessorValueTreeState& apvts,
+                   const ParamSnapshot& params,
                    const MacroController& macro) noexcept
 {
     juce::ignoreUnused(playHead);
@@ -101,32 +113,16 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
     const int bufferChannels = buffer.getNumChannels();
     
     // Get parameters
-    const bool noiseOn = *apvts.getRawParameterValue(ParameterIDs::noiseOn) > 0.5f;
-    
-    // Debug output for first few calls
-    static int debugCallCount = 0;
-    if (debugCallCount < 5)
-    {
-        DBG("Noise::process - Call " << debugCallCount << ", noiseOn: " << (noiseOn ? "YES" : "NO") << ", numSamples: " << numSamples);
-        debugCallCount++;
-    }
+    const bool noiseOn = params.noiseOn;
     
     if (!noiseOn)
         return;
     
-    const int noiseTypeInt = static_cast<int>(*apvts.getRawParameterValue(ParameterIDs::noiseType));
-    const float baseLevelDb = *apvts.getRawParameterValue(ParameterIDs::noiseLevel);
-    const float age = *apvts.getRawParameterValue(ParameterIDs::noiseAge);
-    const float width = *apvts.getRawParameterValue(ParameterIDs::noiseWidth);
-    const float flutterGateAmount = *apvts.getRawParameterValue(ParameterIDs::noiseFlutterGate);
-    
-    // Debug parameter reading
-    static int paramDebugCount = 0;
-    if (paramDebugCount < 10)
-    {
-        DBG("RAW noiseTypeInt from parameter: " << noiseTypeInt);
-        paramDebugCount++;
-    }
+    const int noiseTypeInt = params.noiseType;
+    const float baseLevelDb = params.noiseLevel;
+    const float age = params.noiseAge;
+    const float width = params.noiseWidth;
+    const float flutterGateAmount = params.noiseFlutterGate;
     
     // Apply macro modulation with guardrails
     const float levelDb = juce::jlimit(-60.0f, 12.0f, baseLevelDb + macro.noiseLevelAddDb());
@@ -135,13 +131,7 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
     currentNoiseType = static_cast<NoiseAssetManager::NoiseType>(
         juce::jlimit(0, static_cast<int>(NoiseAssetManager::NoiseType::NumTypes) - 1, noiseTypeInt));
         
-    if (paramDebugCount < 10)
-    {
-        DBG("After limits - currentNoiseType: " << static_cast<int>(currentNoiseType));
-    }
-    
-    // Initialize smoothers on first call (they weren't initialized in reset())
-    static bool smoothersInitialized = false;
+    // Initialize smoothers on first call after reset (they weren't initialized in reset())
     if (!smoothersInitialized)
     {
         levelSmoothed.setCurrentAndTargetValue(ParameterHelper::decibelToLinear(levelDb));
@@ -149,7 +139,6 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
         widthSmoothed.setCurrentAndTargetValue(width);
         flutterGateSmoothed.setCurrentAndTargetValue(flutterGateAmount);
         smoothersInitialized = true;
-        DBG("Noise smoothers initialized - levelDb: " << levelDb << ", linear: " << ParameterHelper::decibelToLinear(levelDb));
     }
     
     // Update smoothed parameters
@@ -158,9 +147,6 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
     widthSmoothed.setTargetValue(width);
     flutterGateSmoothed.setTargetValue(flutterGateAmount);
     
-    // Update age filters once per block
-    updateAgeFilters(ageSmoothed.getCurrentValue());
-    
     // Update flutter gate envelope
     updateFlutterGate(buffer, numSamples);
     
@@ -169,54 +155,47 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
     bool useProcedural = assetManager.needsProceduralFallback(currentNoiseType);
     const NoiseAssetManager::AssetBuffer* assetBuffer = nullptr;
     
-    // Debug: Show why we're using procedural or not
-    static int pathDebugCount = 0;
-    if (pathDebugCount < 3)
-    {
-        DBG("Noise type " << static_cast<int>(currentNoiseType) << " - isProceduralType: " << 
-            (NoiseAssetManager::isProceduralType(currentNoiseType) ? "YES" : "NO"));
-        pathDebugCount++;
-    }
-    
     if (!useProcedural)
     {
         assetBuffer = assetManager.getAssetForType(currentNoiseType);
         useProcedural = (assetBuffer == nullptr);
     }
     
-    // Debug output for processing path
-    static int processDebugCount = 0;
-    if (processDebugCount < 5)
-    {
-        DBG("=== NOISE DEBUG ===");
-        DBG("Type: " << static_cast<int>(currentNoiseType) << " (" << 
-            (currentNoiseType == NoiseAssetManager::NoiseType::Vinyl ? "Vinyl" :
-             currentNoiseType == NoiseAssetManager::NoiseType::Tape ? "Tape" :
-             currentNoiseType == NoiseAssetManager::NoiseType::Hum ? "Hum" :
-             currentNoiseType == NoiseAssetManager::NoiseType::Fan ? "Fan" :
-             currentNoiseType == NoiseAssetManager::NoiseType::JazzClub ? "JazzClub" : "Unknown") << ")");
-        DBG("needsProceduralFallback: " << (assetManager.needsProceduralFallback(currentNoiseType) ? "YES" : "NO"));
-        DBG("UseProcedural: " << (useProcedural ? "YES" : "NO"));
-        DBG("AssetBuffer: " << (assetBuffer ? "VALID" : "NULL"));
-        if (assetBuffer)
-        {
-            DBG("  Asset filename: " << assetBuffer->filename);
-            DBG("  Asset length: " << assetBuffer->buffer.getNumSamples() << " samples");
-        }
-        processDebugCount++;
-    }
+    // Temporary buffers for noise generation, borrowed from the processor's scratch arena
+    jassert(scratchArena != nullptr);
+    if (scratchArena == nullptr)
+        return;
+    
+    ScratchArena::Scope scratchScope(*scratchArena);
+    
+    // One noise channel per output channel, plus a spare that takes the unused half
+    // of the stereo generator for unpaired channels. The spare comes as loose floats so
+    // that a full ScratchArena::maxChannels layout still fits in the buffer.
+    auto noiseBuffer = scratchArena->getBuffer(bufferChannels, numSamples);
+    float* spareChannel = scratchArena->getFloats(numSamples);
+    if (noiseBuffer.getNumChannels() != bufferChannels || spareChannel == nullptr)
+        return;
     
-    // Temporary buffers for noise generation
-    juce::AudioBuffer<float> noiseBuffer(2, numSamples);
     noiseBuffer.clear();
+    juce::FloatVectorOperations::clear(spareChannel, numSamples);
+    
+    const int noiseChannels = std::min(bufferChannels, static_cast<int>(grainStates.size()));
     
     if (useProcedural)
     {
-        // Use procedural generator
-        proceduralGen->generateNoise(currentNoiseType,
-                                    noiseBuffer.getWritePointer(0),
-                                    noiseBuffer.getWritePointer(1),
-                                    numSamples);
+        // Use procedural generator, once per pair (or unpaired channel)
+        for (int ch = 0; ch < noiseChannels; ++ch)
+        {
+            if (channelPairs.isRightOfPair(ch))
+                continue;
+            
+            const int partner = channelPairs.getPartner(ch);
+            proceduralGen->generateNoise(currentNoiseType,
+                                        noiseBuffer.getWritePointer(ch),
+                                        juce::isPositiveAndBelow(partner, noiseChannels) ? noiseBuffer.getWritePointer(partner)
+                                                                                        : spareChannel,
+                                        numSamples);
+        }
     }
     else
     {
@@ -231,30 +210,27 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
         // Calculate sample rate ratio for correct playback speed
         const double sampleRateRatio = assetSampleRate / sampleRate;
         
-        // Debug sample rate info
-        static int srDebugCount = 0;
-        if (srDebugCount < 3)
-        {
-            DBG("Asset sample rate: " << assetSampleRate << "Hz, Plugin sample rate: " << sampleRate << "Hz, Ratio: " << sampleRateRatio);
-            srDebugCount++;
-        }
-        
         if (sourceLength > 0 && loopLength > 0)
         {
-            for (int ch = 0; ch < std::min(2, bufferChannels); ++ch)
+            for (int ch = 0; ch < noiseChannels; ++ch)
             {
                 auto& grain = grainStates[ch]; // Reuse state structure for simple playback position
                 auto* noiseOut = noiseBuffer.getWritePointer(ch);
                 
+                // Left of each pair (and unpaired channels) reads the asset's first channel, right its second
+                const int sourceChannel = (channelPairs.isRightOfPair(ch) ? 1 : 0) % sourceBuffer.getNumChannels();
+                
+                // A pair's start offset can be longer than a short loop
+                if (grain.readPosition >= loopLength)
+                    grain.readPosition = std::fmod(grain.readPosition, static_cast<double>(loopLength));
+                
                 for (int sample = 0; sample < numSamples; ++sample)
                 {
                     // Simple linear playback with seamless looping
                     double position = loopStart + grain.readPosition;
                     
                     // Get interpolated sample
-                    float outputSample = getInterpolatedSample(sourceBuffer, 
-                                                             ch % sourceBuffer.getNumChannels(),
-                                                             position);
+                    float outputSample = getInterpolatedSample(sourceBuffer, sourceChannel, position);
                     
                     // Apply per-type level adjustments
                     if (currentNoiseType == NoiseAssetManager::NoiseType::JazzClub)
@@ -273,64 +249,60 @@ void Noise::process(juce::AudioBuffer<float>& buffer,
         }
     }
     
-    // Process noise through Age filters and effects
-    for (int ch = 0; ch < std::min(2, bufferChannels); ++ch)
+    // Process noise through Age filters and effects, a group of channels per SIMD register.
+    // Gate and level are shared by every channel, so they advance once per sample.
+    const int filteredChannels = std::min(noiseChannels, static_cast<int>(ageFilters.size()) * laneWidth);
+    const int numGroups = getNumLaneGroups(filteredChannels);
+    
+    LaneGroup groups[maxLaneGroups];
+    for (int group = 0; group < numGroups; ++group)
+        groups[group] = LaneGroup(noiseBuffer, group, filteredChannels);
+    
+    for (int sample = 0; sample < numSamples; ++sample)
     {
-        auto* noiseData = noiseBuffer.getWritePointer(ch);
-        auto& ageFilter = ageFilters[ch];
+        // Flutter gate and level together, as one gain
+        const float gain = applyFlutterGate(1.0f, flutterGateSmoothed.getNextValue()) * levelSmoothed.getNextValue();
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        // Age glides one sub-block at a time
+        if (sample % BiquadTable::subBlockSize == 0)
+            updateAgeFilters(ageSmoothed.skip(juce::jmin(BiquadTable::subBlockSize, numSamples - sample)));
+        
+        for (int group = 0; group < numGroups; ++group)
         {
+            auto& ageFilter = ageFilters[static_cast<size_t>(group)];
+            
             // Apply age filtering
-            float processed = noiseData[sample];
+            auto processed = groups[group].load(sample);
             processed = ageFilter.highpass.processSample(processed);
             processed = ageFilter.lowpass.processSample(processed);
             processed = ageFilter.midDip.processSample(processed);
             
-            // Apply flutter gate
-            processed = applyFlutterGate(processed, flutterGateSmoothed.getNextValue());
-            
-            // Apply level
-            processed *= levelSmoothed.getNextValue();
-            
-            noiseData[sample] = processed;
+            groups[group].store(sample, processed * gain);
         }
     }
     
-    // Apply width processing (M/S)
-    if (bufferChannels >= 2)
+    // Apply width processing (M/S) within each pair
+    if (channelPairs.getNumPairs() > 0)
     {
-        auto* leftData = noiseBuffer.getWritePointer(0);
-        auto* rightData = noiseBuffer.getWritePointer(1);
-        
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            float left = leftData[sample];
-            float right = rightData[sample];
+            const float currentWidth = widthSmoothed.getNextValue();
             
-            applyWidthProcessing(left, right, widthSmoothed.getNextValue());
-            
-            leftData[sample] = left;
-            rightData[sample] = right;
-        }
-    }
-    
-    // Debug: Check noise signal levels before mixing
-    static int mixDebugCount = 0;
-    if (mixDebugCount < 3)
-    {
-        float maxLevel = 0.0f;
-        for (int ch = 0; ch < noiseBuffer.getNumChannels(); ++ch)
-        {
-            auto magnitude = noiseBuffer.getMagnitude(ch, 0, numSamples);
-            maxLevel = std::max(maxLevel, magnitude);
+            for (const auto& pair : channelPairs)
+            {
+                if (pair.right >= noiseChannels)
+                    continue;
+                
+                float& left = noiseBuffer.getWritePointer(pair.left)[sample];
+                float& right = noiseBuffer.getWritePointer(pair.right)[sample];
+                
+                applyWidthProcessing(left, right, currentWidth);
+            }
         }
-        DBG("Noise signal magnitude before mixing: " << maxLevel << " (should be > 0 if working)");
-        mixDebugCount++;
     }
     
     // Mix noise into output buffer
-    for (int ch = 0; ch < std::min(bufferChannels, noiseBuffer.getNumChannels()); ++ch)
+    for (int ch = 0; ch < noiseChannels; ++ch)
     {
         buffer.addFrom(ch, 0, noiseBuffer, ch, 0, numSamples);
     }
@@ -367,28 +339,20 @@ float Noise::getNextRandomOffset(GrainState& state) const noexcept
     return (rand - 0.5f) * 2.0f; // -1 to 1
 }
 
-void Noise::updateAgeFilters(float ageAmount)
+void Noise::updateAgeFilters(float ageAmount) noexcept
 {
-    // Map age 0..1 to filter parameters
-    // HPF: 20Hz -> 120Hz
-    // LPF: 20kHz -> 6kHz  
-    // Mid dip: 0dB -> -6dB
-    
-    float hpFreq = 20.0f + ageAmount * 100.0f;
-    float lpFreq = 20000.0f - ageAmount * 14000.0f;
-    float midGain = juce::Decibels::decibelsToGain(-ageAmount * 6.0f);
-    
-    auto hpCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, hpFreq);
-    auto lpCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, lpFreq);
-    auto midCoeffs = juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-        sampleRate, 2000.0f, 0.5f, midGain);
-    
-    for (auto& filter : ageFilters)
-    {
-        filter.highpass.coefficients = hpCoeffs;
-        filter.lowpass.coefficients = lpCoeffs;
-        filter.midDip.coefficients = midCoeffs;
-    }
+    // Table lookups, so nothing is designed or allocated on the audio thread
+    if (ageHighpassTable.update(ageAmount))
+        for (auto& filter : ageFilters)
+            filter.highpass.setCoefficients(ageHighpassTable.getCurrent());
+    
+    if (ageLowpassTable.update(ageAmount))
+        for (auto& filter : ageFilters)
+            filter.lowpass.setCoefficients(ageLowpassTable.getCurrent());
+    
+    if (ageMidDipTable.update(ageAmount))
+        for (auto& filter : ageFilters)
+            filter.midDip.setCoefficients(ageMidDipTable.getCurrent());
 }
 
 void Noise::updateFlutterGate(const juce::AudioBuffer<float>& inputBuffer, int numSamples)
@@ -2,6 +2,10 @@
 
 #include <JuceHeader.h>
 #include "noise/NoiseAssetManager.h"
+#include "../core/ScratchArena.h"
+#include "shared/ChannelPairs.h"
+#include "shared/ChannelLanes.h"
+#include "shared/BiquadTable.h"
 #include <array>
 
 namespace ReallyCheap
@@ -9,6 +13,7 @@ namespace ReallyCheap
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 class Noise
 {
@@ -21,15 +26,23 @@ public:
     // Processes in-place by mixing noise into buffer
     void process(juce::AudioBuffer<float>& buffer,
                 juce::AudioPlayHead* playHead,
-                juce::AudioProcessorValueTreeState& apvts,
+                const ParamSnapshot& params,
                 const MacroController& macro) noexcept;
     
+    // Temporary buffers are taken from this arena; it must outlive the module
+    void setScratchArena(ScratchArena& arena) noexcept { scratchArena = &arena; }
+    
+    // Each pair gets its own stereo noise bed, and width acts within the pair
+    void setChannelPairs(const ChannelPairs& pairs) noexcept { channelPairs = pairs; }
+    
     // Called from message thread to load/replace assets safely
     static void requestAssetPreload(const juce::File& folder);
     
 private:
     double sampleRate = 44100.0;
     int numChannels = 2;
+    ScratchArena* scratchArena = nullptr;
+    ChannelPairs channelPairs;
     
     // Grain engine state per channel
     struct GrainState
@@ -69,16 +82,22 @@ private:
     juce::SmoothedValue<float> ageSmoothed;
     juce::SmoothedValue<float> widthSmoothed;
     juce::SmoothedValue<float> flutterGateSmoothed;
+    bool smoothersInitialized = false;
     
-    // Age filter state (per channel)
+    // Age filter state (per group of laneWidth channels)
     struct AgeFilterState
     {
-        juce::dsp::IIR::Filter<float> highpass;
-        juce::dsp::IIR::Filter<float> lowpass;
-        juce::dsp::IIR::Filter<float> midDip; // Gentle mid scoop for aged sound
+        LaneBiquad highpass;
+        LaneBiquad lowpass;
+        LaneBiquad midDip; // Gentle mid scoop for aged sound
     };
     std::vector<AgeFilterState> ageFilters;
     
+    // Age responses, designed in prepare() over the 0..1 control
+    BiquadTable ageHighpassTable;
+    BiquadTable ageLowpassTable;
+    BiquadTable ageMidDipTable;
+    
     // Flutter gate state
     struct FlutterGateState
     {
@@ -92,11 +111,12 @@ private:
     static constexpr float grainSizeMs = 80.0f; // 80ms grains
     static constexpr float crossfadeSizeMs = 15.0f; // 15ms crossfades
     static constexpr float maxOffsetMs = 100.0f; // ±100ms random offset
+    static constexpr double leadChannelOffsetSamples = 48000.0 * 1.3; // Asset start offset per pair, so pairs do not correlate
     
     // Helper functions
     float getHannWindow(float phase) const noexcept;
     float getNextRandomOffset(GrainState& state) const noexcept;
-    void updateAgeFilters(float ageAmount);
+    void updateAgeFilters(float ageAmount) noexcept;
     void updateFlutterGate(const juce::AudioBuffer<float>& inputBuffer, int numSamples);
     float applyFlutterGate(float input, float gateAmount) noexcept;
     void applyWidthProcessing(float& left, float& right, float width) noexcept;
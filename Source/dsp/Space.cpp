@@ -1,6 +1,7 @@
 #include "Space.h"
 #include "../core/Params.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 
 namespace ReallyCheap
 {
@@ -16,13 +17,31 @@ void Space::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
     numChannels = numChannels_;
     
     // Setup pre-delay lines (max 30ms)
+    maxPreDelaySamples = static_cast<int>(30 * 0.001 * sampleRate);
     preDelayLines.clear();
     preDelayLines.resize(numChannels);
     for (auto& delayLine : preDelayLines)
     {
-        delayLine.prepare(sampleRate, 30); // 30ms max
+        delayLine.prepare(maxPreDelaySamples, blockSize);
     }
     
+    // Map tilt amount (-1 to +1) to shelf gains
+    // Negative = darker (boost low, cut high)
+    // Positive = brighter (cut low, boost high)
+    tiltLowTable.prepare(-1.0f, 1.0f, [this] (float tiltAmount)
+    {
+        const float lowGainDb = -tiltAmount * 2.0f;  // ±2dB at 200Hz - less low cut
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeLowShelf(
+            sampleRate, 200.0f, 0.707f, juce::Decibels::decibelsToGain(lowGainDb));
+    });
+    
+    tiltHighTable.prepare(-1.0f, 1.0f, [this] (float tiltAmount)
+    {
+        const float highGainDb = tiltAmount * 8.0f;  // ±8dB at 4kHz - even more high-end boost available
+        return juce::dsp::IIR::ArrayCoefficients<float>::makeHighShelf(
+            sampleRate, 4000.0f, 0.707f, juce::Decibels::decibelsToGain(highGainDb));
+    });
+    
     // Setup tone controls
     tiltEQs.clear();
     tiltEQs.resize(numChannels);
@@ -32,24 +51,32 @@ void Space::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
     }
     
     // Setup algorithmic reverb - juicy multi-tap delay network
+    const int numGroups = getNumLaneGroups(numChannels);
     reverbDelays.clear();
-    reverbDelays.resize(numChannels);
-    for (auto& channelDelays : reverbDelays)
+    reverbDelays.resize(static_cast<size_t>(numGroups));
+    longestDelaySamples = 0;
+    
+    // Different delay times for each tap - extended range for longer tails
+    const std::vector<int> delayTimesMs = {41, 67, 103, 139, 191, 229, 283, 337, 389, 443, 509, 571}; // More prime delays for complexity
+    reverbDelayLengths.clear();
+    for (int delayMs : delayTimesMs)
+    {
+        const int delaySamples = static_cast<int>(delayMs * 0.001 * sampleRate);
+        reverbDelayLengths.push_back(delaySamples);
+        longestDelaySamples = juce::jmax(longestDelaySamples, delaySamples);
+    }
+    
+    for (auto& groupDelays : reverbDelays)
     {
-        // Different delay times for each channel and tap - extended range for longer tails
-        std::vector<int> delayTimesMs = {41, 67, 103, 139, 191, 229, 283, 337, 389, 443, 509, 571}; // More prime delays for complexity
-        channelDelays.resize(delayTimesMs.size());
+        groupDelays.resize(reverbDelayLengths.size());
         
-        for (size_t i = 0; i < channelDelays.size(); ++i)
-        {
-            int delaySamples = static_cast<int>(delayTimesMs[i] * 0.001 * sampleRate);
-            channelDelays[i].resize(delaySamples, 0.0f);
-        }
+        for (size_t i = 0; i < groupDelays.size(); ++i)
+            groupDelays[i].prepare(reverbDelayLengths[i]);
     }
     
     // Initialize reverb state
     reverbState.clear();
-    reverbState.resize(numChannels);
+    reverbState.resize(static_cast<size_t>(numGroups));
     
     // Setup parameter smoothing
     const double smoothTime = 0.02; // 20ms
@@ -59,9 +86,9 @@ void Space::prepare(double sampleRate_, int samplesPerBlock, int numChannels_)
     reverbTimeSmoothed.reset(sampleRate, smoothTime * 4); // Slower for reverb time
     roomSizeSmoothed.reset(sampleRate, smoothTime * 4);
     
-    // Initialize temp buffers
-    wetBuffer.setSize(numChannels, samplesPerBlock);
-    dryBuffer.setSize(numChannels, samplesPerBlock);
+    // Every delay line is read end to end within the longest delay, so that long a run
+    // of quiet reads means the whole network has decayed
+    tailTracker.prepare(longestDelaySamples);
     
     reset();
 }
@@ -75,26 +102,34 @@ void Space::reset()
         eq.reset();
     
     // Clear reverb delays
-    for (auto& channelDelays : reverbDelays)
+    for (auto& groupDelays : reverbDelays)
     {
-        for (auto& delay : channelDelays)
+        for (auto& delay : groupDelays)
         {
-            std::fill(delay.begin(), delay.end(), 0.0f);
+            delay.reset();
         }
     }
     
     // Reset reverb state
-    for (auto& state : reverbState)
+    for (size_t group = 0; group < reverbState.size(); ++group)
     {
-        state.writePos = 0;
+        auto& state = reverbState[group];
         state.feedback = 0.6f;
         state.diffusion = 0.5f;
-        state.lowpass1 = 0.0f;
-        state.lowpass2 = 0.0f;
-        state.allpass1 = 0.0f;
-        state.allpass2 = 0.0f;
+        state.lowpass1 = LaneVector(0.0f);
+        state.lowpass2 = LaneVector(0.0f);
+        state.allpass1 = LaneVector(0.0f);
+        state.allpass2 = LaneVector(0.0f);
+        
+        // Stereo widening inverts the phase on the right of each pair
+        state.widenGain = makeLaneVector(static_cast<int>(group) * laneWidth, [this] (int ch)
+        {
+            return channelPairs.isRightOfPair(ch) ? -0.8f : 1.0f;
+        });
     }
     
+    tailTracker.wake();
+    
     mixSmoothed.setCurrentAndTargetValue(ParameterDefaults::spaceMix);
     preDelaySmoothed.setCurrentAndTargetValue(ParameterDefaults::spacePreDelayMs);
     toneSmoothed.setCurrentAndTargetValue(ParameterDefaults::spaceTone);
@@ -104,7 +139,7 @@ void Space::reset()
 
 void Space::process(juce::AudioBuffer<float>& buffer,
                    juce::AudioPlayHead* playHead,
-                   juce::AudioProcessorValueTreeState& apvts,
+                   const ParamSnapshot& params,
                    const MacroController& macro) noexcept
 {
     juce::ignoreUnused(playHead);
@@ -113,38 +148,21 @@ void Space::process(juce::AudioBuffer<float>& buffer,
     const int bufferChannels = buffer.getNumChannels();
     
     // Get parameters
-    const bool spaceOn = *apvts.getRawParameterValue(ParameterIDs::spaceOn) > 0.5f;
-    
-    // Debug output for first few calls
-    static int debugCallCount = 0;
-    if (debugCallCount < 10)
-    {
-        DBG("Space::process - Call " << debugCallCount << ", spaceOn: " << (spaceOn ? "YES" : "NO") << ", numSamples: " << numSamples);
-        debugCallCount++;
-    }
+    const bool spaceOn = params.spaceOn;
     
     if (!spaceOn)
     {
         return;
     }
     
-    const float baseMix = *apvts.getRawParameterValue(ParameterIDs::spaceMix);
-    const float time = *apvts.getRawParameterValue(ParameterIDs::spaceTime);
-    const float tone = *apvts.getRawParameterValue(ParameterIDs::spaceTone);
-    const float preDelayMs = *apvts.getRawParameterValue(ParameterIDs::spacePreDelayMs);
+    const float baseMix = params.spaceMix;
+    const float time = params.spaceTime;
+    const float tone = params.spaceTone;
+    const float preDelayMs = params.spacePreDelayMs;
     
     // Apply macro modulation with guardrails - use more generous cap
     const float mix = juce::jmin(baseMix, juce::jmax(0.25f, macro.spaceMixCap())); // At least 25% mix allowed
     
-    // Debug processing parameters
-    static int processDebugCount = 0;
-    if (processDebugCount < 5)
-    {
-        DBG("Space::process - PROCESSING! baseMix: " << baseMix << ", mixCap: " << macro.spaceMixCap() << ", finalMix: " << mix << ", time: " << time);
-        juce::ignoreUnused(macro); // Remove warning since we still reference it
-        processDebugCount++;
-    }
-    
     // Map time parameter to reverb characteristics - much longer tails
     const float reverbTime = 1.2f + time * 4.8f; // 1.2s to 6.0s decay time
     const float roomSize = 0.2f + time * 0.6f;   // 0.2 to 0.8 room size (smaller rooms = less damping)
@@ -156,149 +174,230 @@ void Space::process(juce::AudioBuffer<float>& buffer,
     reverbTimeSmoothed.setTargetValue(reverbTime);
     roomSizeSmoothed.setTargetValue(roomSize);
     
-    // Store dry signal for mix
-    dryBuffer.makeCopyOf(buffer);
+    const bool inputSilent = TailTracker::isSilent(buffer);
     
-    // Process wet signal
-    wetBuffer.makeCopyOf(buffer);
+    if (inputSilent && tailTracker.isSleeping())
+    {
+        // The output would be silence; jump the smoothers so waking doesn't ramp from stale values
+        mixSmoothed.setCurrentAndTargetValue(mix);
+        preDelaySmoothed.setCurrentAndTargetValue(preDelayMs);
+        toneSmoothed.setCurrentAndTargetValue(tone);
+        reverbTimeSmoothed.setCurrentAndTargetValue(reverbTime);
+        roomSizeSmoothed.setCurrentAndTargetValue(roomSize);
+        buffer.clear();
+        return;
+    }
+    
+    // Process wet signal in scratch storage; the buffer itself still holds the dry signal for the mix
+    jassert(scratchArena != nullptr);
+    if (scratchArena == nullptr)
+        return;
+    
+    ScratchArena::Scope scratchScope(*scratchArena);
+    auto wetBuffer = scratchArena->getBuffer(bufferChannels, numSamples);
+    if (wetBuffer.getNumChannels() != bufferChannels)
+        return;
+    
+    for (int ch = 0; ch < bufferChannels; ++ch)
+        wetBuffer.copyFrom(ch, 0, buffer, ch, 0, numSamples);
     
-    // Apply pre-delay
-    const float currentPreDelay = preDelaySmoothed.getCurrentValue();
-    const float preDelaySamples = currentPreDelay * 0.001f * static_cast<float>(sampleRate);
+    // Apply pre-delay, gliding one sub-block at a time; no chunk is longer than the prepared
+    // block size, so the lines hold the chunk and the delay together
+    const int preDelayChunk = juce::jmin(blockSize, BiquadTable::subBlockSize);
+    const int preDelayChannels = std::min(bufferChannels, static_cast<int>(preDelayLines.size()));
     
-    for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(preDelayLines.size())); ++ch)
+    for (int start = 0; start < numSamples; start += preDelayChunk)
     {
-        auto* wetData = wetBuffer.getWritePointer(ch);
-        auto& delayLine = preDelayLines[ch];
+        const int chunkSamples = juce::jmin(preDelayChunk, numSamples - start);
+        const float currentPreDelay = preDelaySmoothed.skip(chunkSamples);
+        const float preDelaySamples = juce::jlimit(0.0f, static_cast<float>(maxPreDelaySamples),
+                                                   currentPreDelay * 0.001f * static_cast<float>(sampleRate));
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        for (int ch = 0; ch < preDelayChannels; ++ch)
         {
-            wetData[sample] = delayLine.processSample(wetData[sample], preDelaySamples);
+            auto* wetData = wetBuffer.getWritePointer(ch, start);
+            auto& delayLine = preDelayLines[ch];
+            delayLine.write(wetData, chunkSamples);
+            delayLine.readLinear(preDelaySamples, wetData, chunkSamples);
         }
     }
     
     // Apply algorithmic reverb processing
-    processAlgorithmicReverb(wetBuffer);
-    
-    // Apply tone control
-    const float currentTone = toneSmoothed.getCurrentValue();
+    const float networkPeak = processAlgorithmicReverb(wetBuffer);
     
-    for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(tiltEQs.size())); ++ch)
+    // Apply tone control, gliding the tilt one sub-block at a time
+    for (int start = 0; start < numSamples; start += BiquadTable::subBlockSize)
     {
-        auto& eq = tiltEQs[ch];
-        auto* wetData = wetBuffer.getWritePointer(ch);
+        const int subBlockSamples = juce::jmin(BiquadTable::subBlockSize, numSamples - start);
+        const float currentTone = toneSmoothed.skip(subBlockSamples);
         
-        // Update filter coefficients once per block
-        eq.updateCoeffs(currentTone, sampleRate);
+        // Table lookups only when the tilt has moved
+        const bool lowMoved = tiltLowTable.update(currentTone);
+        const bool highMoved = tiltHighTable.update(currentTone);
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(tiltEQs.size())); ++ch)
         {
-            wetData[sample] = eq.processSample(wetData[sample]);
+            auto& eq = tiltEQs[ch];
+            auto* wetData = wetBuffer.getWritePointer(ch, start);
+            
+            if (lowMoved || highMoved)
+                eq.setCoefficients(tiltLowTable.getCurrent(), tiltHighTable.getCurrent());
+            
+            for (int sample = 0; sample < subBlockSamples; ++sample)
+            {
+                wetData[sample] = eq.processSample(wetData[sample]);
+            }
         }
     }
     
-    // Mix wet and dry signals
-    for (int ch = 0; ch < bufferChannels; ++ch)
+    // Mix wet and dry signals; the mix ramp is shared by every channel
+    auto* const* outputChannels = buffer.getArrayOfWritePointers();
+    const auto* const* wetChannels = wetBuffer.getArrayOfReadPointers();
+    
+    for (int sample = 0; sample < numSamples; ++sample)
     {
-        auto* outputData = buffer.getWritePointer(ch);
-        auto* wetData = wetBuffer.getReadPointer(ch);
-        auto* dryData = dryBuffer.getReadPointer(ch);
+        const float currentMix = mixSmoothed.getNextValue();
         
-        for (int sample = 0; sample < numSamples; ++sample)
+        for (int ch = 0; ch < bufferChannels; ++ch)
         {
-            const float currentMix = mixSmoothed.getNextValue();
-            outputData[sample] = dryData[sample] * (1.0f - currentMix) + wetData[sample] * currentMix;
+            float& output = outputChannels[ch][sample];
+            output = output * (1.0f - currentMix) + wetChannels[ch][sample] * currentMix;
             
             // Safety check
-            if (!std::isfinite(outputData[sample]))
-                outputData[sample] = 0.0f;
+            if (!std::isfinite(output))
+                output = 0.0f;
         }
     }
+    
+    // Residue left in the delay lines is below the threshold, so only the small
+    // filter states are cleared; the next wake starts from effective silence
+    if (tailTracker.addBlock(inputSilent && networkPeak < TailTracker::silenceThreshold, numSamples))
+        clearFilterState();
 }
 
-void Space::processAlgorithmicReverb(juce::AudioBuffer<float>& buffer) noexcept
+void Space::clearFilterState() noexcept
+{
+    for (auto& delayLine : preDelayLines)
+        delayLine.reset();
+    
+    for (auto& eq : tiltEQs)
+        eq.reset();
+    
+    for (auto& state : reverbState)
+    {
+        state.lowpass1 = LaneVector(0.0f);
+        state.lowpass2 = LaneVector(0.0f);
+        state.allpass1 = LaneVector(0.0f);
+        state.allpass2 = LaneVector(0.0f);
+    }
+}
+
+double Space::getTailLengthSeconds() const noexcept
+{
+    if (longestDelaySamples == 0)
+        return 0.0;
+    
+    // Same feedback target processAlgorithmicReverb converges to
+    float feedback = 0.4f + reverbTimeSmoothed.getCurrentValue() * 0.25f;
+    for (const auto& state : reverbState)
+        feedback = juce::jmax(feedback, state.feedback);
+    
+    feedback = juce::jlimit(0.05f, 0.99f, feedback);
+    
+    // Each pass round the longest loop scales the tail by the feedback gain
+    const double passes = std::log(static_cast<double>(TailTracker::silenceThreshold)) / std::log(static_cast<double>(feedback));
+    const double maxPreDelaySeconds = 0.03;
+    
+    return passes * longestDelaySamples / sampleRate + maxPreDelaySeconds;
+}
+
+float Space::processAlgorithmicReverb(juce::AudioBuffer<float>& buffer) noexcept
 {
     const int numSamples = buffer.getNumSamples();
-    const int bufferChannels = buffer.getNumChannels();
+    const int activeChannels = std::min(buffer.getNumChannels(), static_cast<int>(reverbDelays.size()) * laneWidth);
+    auto peakRead = LaneVector(0.0f);
     
-    const float currentReverbTime = reverbTimeSmoothed.getCurrentValue();
-    const float currentRoomSize = roomSizeSmoothed.getCurrentValue();
+    // The network takes its settings once a block, so the smoothers move a block at a time
+    const float currentReverbTime = reverbTimeSmoothed.skip(numSamples);
+    const float currentRoomSize = roomSizeSmoothed.skip(numSamples);
     
     // Calculate feedback based on reverb time - SAFE feedback levels to prevent runaway
     const float targetFeedback = 0.4f + currentReverbTime * 0.25f; // 0.4 to 0.65 feedback (SAFER)
     const float diffusion = 0.6f + currentRoomSize * 0.2f;         // 0.6 to 0.8 diffusion (SAFER)
     
-    for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(reverbDelays.size())); ++ch)
+    // Light high-frequency damping for natural air absorption - but not too much
+    const float dampening = 0.92f + currentRoomSize * 0.06f; // 0.92 to 0.98 - moderate damping for tail preservation
+    
+    // Each network carries laneWidth channels side by side through the same taps
+    for (int group = 0; group < getNumLaneGroups(activeChannels); ++group)
     {
-        auto& channelDelays = reverbDelays[ch];
-        auto& state = reverbState[ch];
-        auto* data = buffer.getWritePointer(ch);
+        auto& groupDelays = reverbDelays[static_cast<size_t>(group)];
+        auto& state = reverbState[static_cast<size_t>(group)];
+        LaneGroup lanes(buffer, group, activeChannels);
         
         // Smooth feedback changes - allow higher feedback with stability
         state.feedback += (targetFeedback - state.feedback) * 0.0005f; // Slower changes for stability at high feedback
         state.diffusion += (diffusion - state.diffusion) * 0.0005f;
         
+        // Apply different gains for each tap to create complexity
+        const float tapGain = 0.8f / static_cast<float>(groupDelays.size());
+        
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            float input = data[sample];
-            float output = 0.0f;
+            const auto input = lanes.load(sample);
+            auto output = LaneVector(0.0f);
             
             // Multi-tap delay network with feedback and diffusion
-            for (size_t i = 0; i < channelDelays.size(); ++i)
+            for (size_t i = 0; i < groupDelays.size(); ++i)
             {
-                auto& delay = channelDelays[i];
-                const int delayLength = static_cast<int>(delay.size());
+                auto& delay = groupDelays[i];
                 
                 // Read from delay line
-                float delayedSample = delay[state.writePos % delayLength];
-                
-                // Apply different gains for each tap to create complexity
-                float tapGain = 0.8f / static_cast<float>(channelDelays.size());
-                if (i % 2 == 0) tapGain *= 1.2f; // Emphasize even taps slightly
+                const auto delayedSample = delay.read(reverbDelayLengths[i]);
+                peakRead = LaneVector::max(peakRead, LaneVector::abs(delayedSample));
                 
-                output += delayedSample * tapGain;
+                output += delayedSample * (i % 2 == 0 ? tapGain * 1.2f : tapGain); // Emphasize even taps slightly
                 
                 // Write new sample to delay line with feedback
-                float inputWithFeedback = input + delayedSample * state.feedback;
+                auto inputWithFeedback = input + delayedSample * state.feedback;
                 
                 // Apply moderate diffusion for spaciousness without killing the tail
                 if (i < 4) // Apply diffusion to more taps for better reverb density
                 {
-                    float allpassOut = inputWithFeedback + state.allpass1 * state.diffusion * 0.7f; // Moderate diffusion
-                    state.allpass1 = inputWithFeedback - allpassOut * state.diffusion * 0.7f;
+                    auto allpassOut = inputWithFeedback + state.allpass1 * (state.diffusion * 0.7f); // Moderate diffusion
+                    state.allpass1 = inputWithFeedback - allpassOut * (state.diffusion * 0.7f);
                     inputWithFeedback = allpassOut;
                     
                     // Second diffusion stage for first few taps
                     if (i < 2)
                     {
-                        allpassOut = inputWithFeedback + state.allpass2 * state.diffusion * 0.5f;
-                        state.allpass2 = inputWithFeedback - allpassOut * state.diffusion * 0.5f;
+                        allpassOut = inputWithFeedback + state.allpass2 * (state.diffusion * 0.5f);
+                        state.allpass2 = inputWithFeedback - allpassOut * (state.diffusion * 0.5f);
                         inputWithFeedback = allpassOut;
                     }
                 }
                 
-                delay[state.writePos % delayLength] = inputWithFeedback;
+                delay.push(inputWithFeedback);
             }
             
-            // Light high-frequency damping for natural air absorption - but not too much
-            const float dampening = 0.92f + currentRoomSize * 0.06f; // 0.92 to 0.98 - moderate damping for tail preservation
             state.lowpass1 = state.lowpass1 * dampening + output * (1.0f - dampening);
             state.lowpass2 = state.lowpass2 * 0.88f + state.lowpass1 * 0.12f; // More gentle but present second stage
             
-            // Add some stereo widening by inverting phase on one channel
-            if (ch == 1)
-                state.lowpass2 *= -0.8f;
-            
-            // SAFETY LIMITING - prevent reverb feedback runaway
-            state.lowpass2 = juce::jlimit(-1.5f, 1.5f, state.lowpass2);
-            if (!std::isfinite(state.lowpass2))
-                state.lowpass2 = 0.0f;
+            // Add some stereo widening by inverting phase on the right of each pair
+            state.lowpass2 *= state.widenGain;
             
-            data[sample] = state.lowpass2;
+            // SAFETY LIMITING - prevent reverb feedback runaway; NaN lanes fail x == x
+            state.lowpass2 = state.lowpass2 & LaneVector::equal(state.lowpass2, state.lowpass2);
+            state.lowpass2 = LaneVector::max(LaneVector(-1.5f), LaneVector::min(state.lowpass2, LaneVector(1.5f)));
             
-            state.writePos++;
+            lanes.store(sample, state.lowpass2);
         }
     }
+    
+    alignas(sizeof(LaneVector)) float peaks[laneWidth];
+    peakRead.copyToRawArray(peaks);
+    
+    return *std::max_element(peaks, peaks + laneWidth);
 }
 
 int Space::getLatencySamples() const noexcept
@@ -315,45 +414,6 @@ void Space::requestIRPreload(const juce::File& folder)
 // Helper Classes Implementation
 //==============================================================================
 
-void Space::PreDelayLine::prepare(double sampleRate, int maxDelayMs)
-{
-    maxDelaySamples = static_cast<int>(maxDelayMs * 0.001 * sampleRate);
-    buffer.resize(maxDelaySamples + 1, 0.0f);
-    writePos = 0;
-}
-
-void Space::PreDelayLine::reset()
-{
-    std::fill(buffer.begin(), buffer.end(), 0.0f);
-    writePos = 0;
-}
-
-float Space::PreDelayLine::processSample(float input, float delaySamples) noexcept
-{
-    // Clamp delay to valid range
-    delaySamples = juce::jlimit(0.0f, static_cast<float>(maxDelaySamples), delaySamples);
-    
-    // Write input to buffer
-    buffer[writePos] = input;
-    
-    // Calculate read position with fractional delay
-    float readPos = static_cast<float>(writePos) - delaySamples;
-    if (readPos < 0.0f)
-        readPos += static_cast<float>(buffer.size());
-    
-    // Linear interpolation
-    int readIndex1 = static_cast<int>(readPos);
-    int readIndex2 = (readIndex1 + 1) % static_cast<int>(buffer.size());
-    float fraction = readPos - static_cast<float>(readIndex1);
-    
-    float output = buffer[readIndex1] + fraction * (buffer[readIndex2] - buffer[readIndex1]);
-    
-    // Advance write position
-    writePos = (writePos + 1) % static_cast<int>(buffer.size());
-    
-    return output;
-}
-
 void Space::TiltEQ::prepare(double sampleRate)
 {
     juce::dsp::ProcessSpec spec;
@@ -364,25 +424,18 @@ void Space::TiltEQ::prepare(double sampleRate)
     lowShelf.prepare(spec);
     highShelf.prepare(spec);
     
+    // Allocate the coefficient objects here so setCoefficients() can overwrite them from the audio thread
+    lowShelf.coefficients = juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, 200.0f, 0.707f, 1.0f);
+    highShelf.coefficients = juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, 4000.0f, 0.707f, 1.0f);
+    
     reset();
 }
 
-void Space::TiltEQ::updateCoeffs(float tiltAmount, double sampleRate)
+void Space::TiltEQ::setCoefficients(const BiquadTable::Coefficients& low, const BiquadTable::Coefficients& high) noexcept
 {
-    // Map tilt amount (-1 to +1) to shelf gains
-    // Negative = darker (boost low, cut high)
-    // Positive = brighter (cut low, boost high)
-    
-    float lowGainDb = -tiltAmount * 2.0f;  // ±2dB at 200Hz - less low cut
-    float highGainDb = tiltAmount * 8.0f;  // ±8dB at 4kHz - even more high-end boost available
-    
-    auto lowCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-        sampleRate, 200.0f, 0.707f, juce::Decibels::decibelsToGain(lowGainDb));
-    lowShelf.coefficients = lowCoeffs;
-    
-    auto highCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-        sampleRate, 4000.0f, 0.707f, juce::Decibels::decibelsToGain(highGainDb));
-    highShelf.coefficients = highCoeffs;
+    // Assigned in place: the coefficient objects were created in prepare()
+    *lowShelf.coefficients = low;
+    *highShelf.coefficients = high;
 }
 
 float Space::TiltEQ::processSample(float input) noexcept
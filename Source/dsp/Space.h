@@ -1,12 +1,19 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../core/ScratchArena.h"
+#include "shared/TailTracker.h"
+#include "shared/ChannelPairs.h"
+#include "shared/ChannelLanes.h"
+#include "shared/BiquadTable.h"
+#include "shared/DelayLine.h"
 
 namespace ReallyCheap
 {
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 class Space
 {
@@ -18,12 +25,24 @@ public:
     
     void process(juce::AudioBuffer<float>& buffer,
                 juce::AudioPlayHead* playHead,
-                juce::AudioProcessorValueTreeState& apvts,
+                const ParamSnapshot& params,
                 const MacroController& macro) noexcept;
     
     // Get latency for processor-wide compensation
     int getLatencySamples() const noexcept;
     
+    // True once the delay network has decayed below the silence threshold
+    bool isAsleep() const noexcept { return tailTracker.isSleeping(); }
+    
+    // Time for the delay network to decay to the silence threshold at the current feedback
+    double getTailLengthSeconds() const noexcept;
+    
+    // Temporary buffers are taken from this arena; it must outlive the module
+    void setScratchArena(ScratchArena& arena) noexcept { scratchArena = &arena; }
+    
+    // The right channel of each pair is phase-flipped for width
+    void setChannelPairs(const ChannelPairs& pairs) noexcept { channelPairs = pairs; }
+    
     // Message-thread call to load/reload IRs (legacy - not used in algorithmic version)
     static void requestIRPreload(const juce::File& folder);
     
@@ -31,20 +50,12 @@ private:
     double sampleRate = 44100.0;
     int blockSize = 512;
     int numChannels = 2;
+    ScratchArena* scratchArena = nullptr;
+    ChannelPairs channelPairs;
     
-    // Pre-delay line
-    struct PreDelayLine
-    {
-        std::vector<float> buffer;
-        int writePos = 0;
-        int maxDelaySamples = 0;
-        
-        void prepare(double sampleRate, int maxDelayMs);
-        void reset();
-        float processSample(float input, float delaySamples) noexcept;
-    };
-    
-    std::vector<PreDelayLine> preDelayLines;
+    // Pre-delay lines, one per channel
+    std::vector<DelayLine<float>> preDelayLines;
+    int maxPreDelaySamples = 0;
     
     // Tone control (tilt EQ)
     struct TiltEQ
@@ -53,28 +64,35 @@ private:
         juce::dsp::IIR::Filter<float> highShelf;
         
         void prepare(double sampleRate);
-        void updateCoeffs(float tiltAmount, double sampleRate);
+        void setCoefficients(const BiquadTable::Coefficients& low, const BiquadTable::Coefficients& high) noexcept;
         float processSample(float input) noexcept;
         void reset();
     };
     
     std::vector<TiltEQ> tiltEQs;
     
-    // Algorithmic reverb structures
-    std::vector<std::vector<std::vector<float>>> reverbDelays; // [channel][tap][delay_buffer]
+    // Shelf responses across the -1..+1 tilt, designed in prepare()
+    BiquadTable tiltLowTable;
+    BiquadTable tiltHighTable;
+    
+    // Algorithmic reverb structures, one network per group of laneWidth channels
+    std::vector<std::vector<DelayLine<LaneVector>>> reverbDelays; // [group][tap]
+    std::vector<int> reverbDelayLengths; // [tap], in samples
     
     struct ReverbState
     {
-        int writePos = 0;
         float feedback = 0.6f;
         float diffusion = 0.5f;
-        float lowpass1 = 0.0f;
-        float lowpass2 = 0.0f;
-        float allpass1 = 0.0f;
-        float allpass2 = 0.0f;
+        LaneVector lowpass1 { 0.0f };
+        LaneVector lowpass2 { 0.0f };
+        LaneVector allpass1 { 0.0f };
+        LaneVector allpass2 { 0.0f };
+        LaneVector widenGain { 1.0f }; // -0.8 in the lanes of right-of-pair channels
     };
     
     std::vector<ReverbState> reverbState;
+    int longestDelaySamples = 0;
+    TailTracker tailTracker;
     
     // Parameter smoothing
     juce::SmoothedValue<float> mixSmoothed;
@@ -83,12 +101,10 @@ private:
     juce::SmoothedValue<float> reverbTimeSmoothed;
     juce::SmoothedValue<float> roomSizeSmoothed;
     
-    // Temporary buffers
-    juce::AudioBuffer<float> wetBuffer;
-    juce::AudioBuffer<float> dryBuffer;
-    
     // Processing methods
-    void processAlgorithmicReverb(juce::AudioBuffer<float>& buffer) noexcept;
+    // Returns the largest magnitude read from the delay network, which is where the tail lives
+    float processAlgorithmicReverb(juce::AudioBuffer<float>& buffer) noexcept;
+    void clearFilterState() noexcept;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Space)
 };
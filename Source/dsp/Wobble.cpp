@@ -1,6 +1,7 @@
 #include "Wobble.h"
 #include "../core/Params.h"
 #include "../core/MacroController.h"
+#include "../core/ParamSnapshot.h"
 #include <cmath>
 
 namespace ReallyCheap
@@ -8,48 +9,53 @@ namespace ReallyCheap
 
 Wobble::Wobble()
 {
-    random.setSeedRandomly();
 }
 
 void Wobble::prepare(double sampleRate_, int blockSize, int numChannels_)
 {
-    juce::ignoreUnused(blockSize);
     sampleRate = sampleRate_;
     numChannels = numChannels_;
+    maxBlockSize = juce::jmax(1, blockSize);
     
     channels.clear();
     channels.resize(numChannels);
     
+    // One control point per interval plus the one the block starts from; two noise draws a point
+    controlStride = (maxBlockSize + controlInterval - 1) / controlInterval + 1;
+    controlModulation.assign(static_cast<size_t>(controlStride * numChannels), 0.0f);
+    controlNoise.assign(static_cast<size_t>(2 * controlStride * numChannels), 0.0f);
+    
     // Smaller delay buffer for subtle tape modulation
     // Based on research: 30-100ms typical for pitch shifting without echo artifacts
     const float maxDelayMs = 50.0f; // Middle ground for quality
-    int maxDelayInSamples = static_cast<int>(std::ceil(maxDelayMs * 0.001 * sampleRate));
+    maxDelaySamples = static_cast<int>(std::ceil(maxDelayMs * 0.001 * sampleRate));
+    
+    // The sinc tier's table is shared and built on first use, which must not be on the audio thread
+    SincTable::get();
     
     for (auto& channel : channels)
     {
         // Initialize circular buffer for variable delay
-        channel.delaySize = maxDelayInSamples;
-        channel.delayLine.resize(channel.delaySize);
-        std::fill(channel.delayLine.begin(), channel.delayLine.end(), 0.0f);
-        channel.delayWritePos = 0;
+        channel.delayLine.prepare(maxDelaySamples, maxBlockSize);
         
         // Initialize modulation state
         channel.lfoPhase = 0.0;
-        channel.prevModValue = 0.0f;
-        channel.jitterSmooth = 0.0f;
-        
-        // Initialize crossfade state for smooth transitions
-        channel.crossfadeAmount = 0.0f;
-        channel.oldReadPos = 0.0f;
-        channel.newReadPos = 0.0f;
-        
-        // Anti-aliasing filter state (2nd order Butterworth)
-        channel.lpf_x1 = 0.0f;
-        channel.lpf_x2 = 0.0f;
-        channel.lpf_y1 = 0.0f;
-        channel.lpf_y2 = 0.0f;
+        channel.jitter.reset();
+        channel.drift.reset();
+        channel.lastModValue = 0.0f;
     }
     
+    // Anti-aliasing filter (Butterworth at 15kHz); it only depends on the sample rate
+    const auto antiAliasCoeffs = juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(sampleRate, 15000.0f);
+    
+    antiAliasFilters.clear();
+    antiAliasFilters.resize(static_cast<size_t>(getNumLaneGroups(numChannels)));
+    for (auto& filter : antiAliasFilters)
+        filter.setCoefficients(antiAliasCoeffs);
+    
+    // Silent input has flushed the delay line once it has travelled its full length
+    tailTracker.prepare(maxDelaySamples + 64);
+    
     reset();
 }
 
@@ -60,224 +66,294 @@ void Wobble::reset()
         auto& channel = channels[ch];
         
         // Reset phases
-        channel.lfoPhase = (ch == 1) ? 0.25 : 0.0; // 90° offset for stereo
-        channel.prevModValue = 0.0f;
-        channel.jitterSmooth = 0.0f;
-        
+        channel.lfoPhase = channelPairs.isRightOfPair(ch) ? 0.25 : 0.0; // 90° offset within each pair
+        channel.jitter.reset();
+        channel.drift.reset();
+        channel.lastModValue = 0.0f;
+    }
+    
+    lastPpqPosition = std::numeric_limits<double>::quiet_NaN();
+    
+    clearDelayState();
+    tailTracker.wake();
+}
+
+void Wobble::clearDelayState() noexcept
+{
+    for (auto& channel : channels)
+    {
         // Clear delay buffer
-        std::fill(channel.delayLine.begin(), channel.delayLine.end(), 0.0f);
-        channel.delayWritePos = 0;
-        
-        // Reset filter states
-        channel.lpf_x1 = channel.lpf_x2 = 0.0f;
-        channel.lpf_y1 = channel.lpf_y2 = 0.0f;
-        
-        // Reset crossfade
-        channel.crossfadeAmount = 0.0f;
-        channel.oldReadPos = 0.0f;
-        channel.newReadPos = 0.0f;
+        channel.delayLine.reset();
     }
+    
+    // Reset filter states
+    for (auto& filter : antiAliasFilters)
+        filter.reset();
+}
+
+double Wobble::getTailLengthSeconds() const noexcept
+{
+    return static_cast<double>(maxDelaySamples) / sampleRate;
 }
 
 void Wobble::process(juce::AudioBuffer<float>& buffer, 
                      juce::AudioPlayHead* playHead, 
-                     juce::AudioProcessorValueTreeState& apvts,
+                     const ParamSnapshot& params,
                      const MacroController& macro) noexcept
 {
     const int numSamples = buffer.getNumSamples();
     const int bufferChannels = buffer.getNumChannels();
     
     // Get parameters
-    const bool wobbleOn = *apvts.getRawParameterValue(ParameterIDs::wobbleOn) > 0.5f;
+    const bool wobbleOn = params.wobbleOn;
     if (!wobbleOn) return;
     
-    const float baseDepth = *apvts.getRawParameterValue(ParameterIDs::wobbleDepth);
-    const float baseRateHz = *apvts.getRawParameterValue(ParameterIDs::wobbleRateHz);
-    const bool monoMode = *apvts.getRawParameterValue(ParameterIDs::wobbleMono) > 0.5f;
-    const float flutter = *apvts.getRawParameterValue(ParameterIDs::wobbleFlutter);
-    const float drift = *apvts.getRawParameterValue(ParameterIDs::wobbleDrift);
-    const float jitter = *apvts.getRawParameterValue(ParameterIDs::wobbleJitter);
-    const float stereoLink = *apvts.getRawParameterValue(ParameterIDs::wobbleStereoLink);
+    // The control points are sized for the block size given to prepare(); longer blocks go in pieces
+    if (numSamples > maxBlockSize)
+    {
+        for (int start = 0; start < numSamples; start += maxBlockSize)
+        {
+            juce::AudioBuffer<float> piece(buffer.getArrayOfWritePointers(), bufferChannels,
+                                           start, juce::jmin(maxBlockSize, numSamples - start));
+            process(piece, playHead, params, macro);
+        }
+        return;
+    }
+
+    ModulationAmounts amounts;
+    amounts.flutter = params.wobbleFlutter;
+    amounts.drift = params.wobbleDrift;
+    amounts.jitter = params.wobbleJitter;
+    amounts.stereoLink = params.wobbleStereoLink;
+    amounts.mono = params.wobbleMono;
     
     // Apply macro modulation
     const float depthGain = macro.wobbleDepthGain();
-    const float depth = baseDepth * depthGain;
-    const float rateHz = juce::jlimit(0.1f, 10.0f, baseRateHz);
+    amounts.depth = params.wobbleDepth * depthGain;
+    const float rateHz = juce::jlimit(0.1f, 10.0f, params.wobbleRateHz);
+    
+    // Calculate phase increment
+    const double phaseInc = updateSync(playHead, rateHz, params.wobbleSync);
+    
+    // Drift wanders about 25 times slower than the wow
+    amounts.driftCutoffHz = static_cast<float>(phaseInc * sampleRate * 0.04);
+    
+    const bool inputSilent = TailTracker::isSilent(buffer);
+    
+    if (inputSilent && tailTracker.isSleeping())
+    {
+        // Nothing left in the delay line: keep the LFOs moving so they resume in step
+        const double phaseAdvance = static_cast<double>(numSamples) * phaseInc;
+        for (auto& channel : channels)
+            channel.lfoPhase = std::fmod(channel.lfoPhase + phaseAdvance, 1.0);
+        
+        buffer.clear();
+        return;
+    }
     
     // Calculate modulation parameters based on research
     // Key insight: Variable sampling rate approach is smoother than position modulation
     // We'll simulate this by using smooth delay changes
     
-    // Process each channel
-    for (int ch = 0; ch < std::min(bufferChannels, static_cast<int>(channels.size())); ++ch)
+    // Mix with dry signal based on depth (subtle blending)
+    const float wetMix = juce::jlimit(0.0f, 1.0f, amounts.depth * 2.0f); // Full wet at 50% depth
+    
+    const int activeChannels = juce::jmin(bufferChannels, numChannels);
+    
+    // Linear for big realtime sessions, sinc for mastering and for every offline render
+    const auto interpolation = nonRealtime ? DelayInterpolation::sinc
+                                           : static_cast<DelayInterpolation>(juce::jlimit(0, 2, params.wobbleQuality));
+    
+    // Filtered input for the delay lines, and one channel's delay times at a time
+    jassert(scratchArena != nullptr && blockRandom != nullptr);
+    if (scratchArena == nullptr)
+        return;
+    
+    ScratchArena::Scope scratchScope(*scratchArena);
+    auto filtered = scratchArena->getBuffer(activeChannels, numSamples);
+    float* delayTimes = scratchArena->getFloats(numSamples);
+    if (filtered.getNumChannels() != activeChannels || delayTimes == nullptr)
+        return;
+    
+    // Apply anti-aliasing filter to input, a whole group of channels per instruction
+    for (int ch = 0; ch < activeChannels; ++ch)
+        filtered.copyFrom(ch, 0, buffer, ch, 0, numSamples);
+    
+    const int numGroups = getNumLaneGroups(activeChannels);
+    for (int group = 0; group < numGroups; ++group)
     {
-        auto& channel = channels[ch];
-        auto* channelData = buffer.getWritePointer(ch);
-        
-        // Calculate phase increment
-        const double phaseInc = static_cast<double>(rateHz) / sampleRate;
-        
-        // Anti-aliasing filter coefficients (Butterworth at 15kHz)
-        const float cutoff = 15000.0f / static_cast<float>(sampleRate);
-        const float c = 1.0f / std::tan(juce::MathConstants<float>::pi * cutoff);
-        const float c2 = c * c;
-        const float sqrt2c = std::sqrt(2.0f) * c;
-        const float a0 = c2 + sqrt2c + 1.0f;
-        const float a1 = 2.0f * (1.0f - c2) / a0;
-        const float a2 = (c2 - sqrt2c + 1.0f) / a0;
-        const float b0 = 1.0f / a0;
-        const float b1 = 2.0f / a0;
-        const float b2 = 1.0f / a0;
+        LaneGroup lanes(filtered, group, activeChannels);
+        auto& filter = antiAliasFilters[static_cast<size_t>(group)];
         
         for (int sample = 0; sample < numSamples; ++sample)
+            lanes.store(sample, filter.processSample(lanes.load(sample)));
+    }
+    
+    // Every channel's modulation for the block is known up front, so the stereo link and
+    // mono modes read their partner's curve and the channels no longer wait on each other
+    computeModulation(numSamples, activeChannels, amounts, phaseInc);
+    
+    for (int ch = 0; ch < activeChannels; ++ch)
+        processChannel(channels[static_cast<size_t>(ch)], buffer.getWritePointer(ch), filtered.getReadPointer(ch),
+                       controlModulation.data() + ch * controlStride, delayTimes, numSamples, wetMix, interpolation);
+    
+    // Once the delay line has drained, drop its residue so waking starts from true silence
+    if (tailTracker.addBlock(inputSilent, numSamples))
+        clearDelayState();
+}
+
+double Wobble::updateSync(juce::AudioPlayHead* playHead, float rateHz, bool syncOn) noexcept
+{
+    const double freeRunning = static_cast<double>(rateHz) / sampleRate;
+    if (! syncOn || playHead == nullptr)
+        return freeRunning;
+    
+    const auto position = playHead->getPosition();
+    if (! position.hasValue())
+        return freeRunning;
+    
+    const auto bpm = position->getBpm();
+    if (! bpm.hasValue() || *bpm <= 0.0)
+        return freeRunning;
+    
+    const double cyclesPerBeat = getSyncedCyclesPerBeat(rateHz, *bpm);
+    
+    // Each host block brings a new position; the sub-blocks it is split into repeat it and run on
+    // from where the last one ended, which at the synced rate is where the playhead is
+    const auto ppqPosition = position->getPpqPosition();
+    if (position->getIsPlaying() && ppqPosition.hasValue() && *ppqPosition != lastPpqPosition)
+    {
+        lastPpqPosition = *ppqPosition;
+        const double beatPhase = *ppqPosition * cyclesPerBeat;
+        
+        for (size_t ch = 0; ch < channels.size(); ++ch)
         {
-            // Apply anti-aliasing filter to input
-            float input = channelData[sample];
-            float filtered = b0 * input + b1 * channel.lpf_x1 + b2 * channel.lpf_x2
-                           - a1 * channel.lpf_y1 - a2 * channel.lpf_y2;
-            
-            channel.lpf_x2 = channel.lpf_x1;
-            channel.lpf_x1 = input;
-            channel.lpf_y2 = channel.lpf_y1;
-            channel.lpf_y1 = filtered;
-            
-            // Store filtered input in delay line
-            channel.delayLine[channel.delayWritePos] = filtered;
-            
-            // Generate modulation signals
-            float wowValue = std::sin(channel.lfoPhase * juce::MathConstants<float>::twoPi);
-            
-            // Flutter: Higher frequency, smaller amplitude
-            float flutterPhase = channel.lfoPhase * 7.0f; // 7x main rate
-            float flutterValue = std::sin(flutterPhase * juce::MathConstants<float>::twoPi);
+            const double phase = beatPhase + (channelPairs.isRightOfPair(static_cast<int>(ch)) ? 0.25 : 0.0);
+            channels[ch].lfoPhase = phase - std::floor(phase);
+        }
+    }
+    
+    return cyclesPerBeat * *bpm / (60.0 * sampleRate);
+}
+
+double Wobble::getSyncedCyclesPerBeat(float rateHz, double bpm) noexcept
+{
+    // Nearest power of two in cycles per beat, from 16 beats a cycle to 16 cycles a beat
+    const double cyclesPerBeat = static_cast<double>(rateHz) * 60.0 / bpm;
+    const double octaves = juce::jlimit(-4.0, 4.0, std::round(std::log2(cyclesPerBeat)));
+    return std::exp2(octaves);
+}
+
+void Wobble::computeModulation(int numSamples, int activeChannels, const ModulationAmounts& amounts, double phaseInc) noexcept
+{
+    const int numSegments = (numSamples + controlInterval - 1) / controlInterval;
+    const int lastLength = numSamples - (numSegments - 1) * controlInterval;
+    
+    // Every channel's oscillators turn by the same steps, and the random sources share their filters;
+    // only the short last step of a block differs
+    const auto wowStep = QuadratureOscillator::makeRotation(phaseInc * controlInterval);
+    const auto wowLastStep = QuadratureOscillator::makeRotation(phaseInc * lastLength);
+    const auto flutterStep = QuadratureOscillator::makeRotation(phaseInc * controlInterval * flutterRatio);
+    const auto flutterLastStep = QuadratureOscillator::makeRotation(phaseInc * lastLength * flutterRatio);
+    
+    const auto jitterStep = ControlRateNoise::makeStep(jitterCutoffHz, sampleRate, controlInterval, jitterRms);
+    const auto jitterLastStep = ControlRateNoise::makeStep(jitterCutoffHz, sampleRate, lastLength, jitterRms);
+    const auto driftStep = ControlRateNoise::makeStep(amounts.driftCutoffHz, sampleRate, controlInterval, driftRms);
+    const auto driftLastStep = ControlRateNoise::makeStep(amounts.driftCutoffHz, sampleRate, lastLength, driftRms);
+    
+    // The whole block's noise in one draw, a jitter and a drift value per channel and segment
+    const int numDraws = 2 * numSegments * activeChannels;
+    if (blockRandom != nullptr)
+        blockRandom->fillUniform(controlNoise.data(), numDraws);
+    else
+        std::fill(controlNoise.begin(), controlNoise.begin() + numDraws, 0.0f);
+    
+    // Combine modulation sources with proper scaling
+    // Research shows typical wow/flutter is 0.08% to 0.5% speed variation
+    // For a 50ms buffer, this translates to 0.04ms to 0.25ms delay variation
+    const float wowGain = amounts.depth * 0.7f;        // Main wow component
+    const float flutterGain = amounts.flutter * 0.15f; // Flutter is subtle
+    const float driftGain = amounts.drift * 0.5f;      // Drift is noticeable but clean
+    const float jitterGain = amounts.jitter * 0.3f;    // Jitter is audible but clean
+    
+    // Leads first, so the right of each pair can blend with a curve that is already complete
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int ch = 0; ch < activeChannels; ++ch)
+        {
+            const int partner = channelPairs.getPartner(ch);
+            const bool isRight = channelPairs.isRightOfPair(ch);
+            const bool followsPartner = isRight && partner < activeChannels;
             
-            // Drift: Very slow quasi-random modulation
-            float driftPhase = channel.lfoPhase * 0.03f; // Much slower
-            float driftValue = std::sin(driftPhase * juce::MathConstants<float>::twoPi * 1.414f); // Irrational multiplier
+            if (followsPartner != (pass == 1))
+                continue;
             
-            // Jitter: Filtered noise
-            float targetJitter = (random.nextFloat() - 0.5f) * 2.0f;
-            channel.jitterSmooth = channel.jitterSmooth * 0.98f + targetJitter * 0.02f; // Heavy filtering
+            auto& channel = channels[static_cast<size_t>(ch)];
+            float* curve = controlModulation.data() + ch * controlStride;
+            const float* leadCurve = followsPartner ? controlModulation.data() + partner * controlStride : nullptr;
+            const float* noise = controlNoise.data() + 2 * ch * numSegments;
             
-            // Combine modulation sources with proper scaling
-            // Research shows typical wow/flutter is 0.08% to 0.5% speed variation
-            // For a 50ms buffer, this translates to 0.04ms to 0.25ms delay variation
+            // The right's own wow runs a further quarter cycle on from its offset LFO
+            QuadratureOscillator wow, flutter;
+            wow.setPhase(channel.lfoPhase + (isRight ? 0.25 : 0.0));
+            flutter.setPhase(channel.lfoPhase * flutterRatio);
             
-            float totalMod = wowValue * depth * 0.7f +           // Main wow component
-                           flutterValue * flutter * 0.15f +      // Flutter is subtle
-                           driftValue * drift * 0.5f +           // Drift is noticeable but clean
-                           channel.jitterSmooth * jitter * 0.3f; // Jitter is audible but clean
+            // The block starts where the last one ended, so a parameter change never jumps
+            curve[0] = channel.lastModValue;
             
-            // Apply stereo processing
-            if (ch == 1 && !monoMode)
+            for (int point = 1; point <= numSegments; ++point)
             {
-                // Independent stereo with optional linking
-                float offsetPhase = channel.lfoPhase + 0.25; // 90° offset
-                if (offsetPhase >= 1.0) offsetPhase -= 1.0;
-                float stereoWow = std::sin(offsetPhase * juce::MathConstants<float>::twoPi);
+                const bool isLast = point == numSegments;
+                wow.advance(isLast ? wowLastStep : wowStep);
+                flutter.advance(isLast ? flutterLastStep : flutterStep);
                 
-                float independentMod = stereoWow * depth * 0.7f +
-                                     flutterValue * flutter * 0.15f +
-                                     driftValue * drift * 0.5f +
-                                     channel.jitterSmooth * jitter * 0.3f;
+                const float jitterValue = channel.jitter.next(noise[2 * point - 2], isLast ? jitterLastStep : jitterStep);
+                const float driftValue = channel.drift.next(noise[2 * point - 1], isLast ? driftLastStep : driftStep);
                 
-                // Blend with left channel's modulation based on link amount
-                if (stereoLink > 0.0f && channels.size() > 0)
-                {
-                    totalMod = independentMod * (1.0f - stereoLink) + channels[0].prevModValue * stereoLink;
-                }
-                else
-                {
-                    totalMod = independentMod;
-                }
-            }
-            else if (ch == 1 && monoMode && channels.size() > 0)
-            {
-                // Use left channel's modulation
-                totalMod = channels[0].prevModValue;
+                float modulation = wow.getSine() * wowGain + flutter.getSine() * flutterGain
+                                 + driftValue * driftGain + jitterValue * jitterGain;
+                
+                // Apply stereo processing: the right follows its left entirely in mono,
+                // otherwise blends towards it by the link amount, weighted so a full link is exact
+                if (leadCurve != nullptr)
+                    modulation = amounts.mono ? leadCurve[point]
+                                              : modulation * (1.0f - amounts.stereoLink) + leadCurve[point] * amounts.stereoLink;
+                
+                curve[point] = modulation;
             }
             
-            // Smooth modulation to prevent zipper noise
-            float smoothedMod = channel.prevModValue * 0.9f + totalMod * 0.1f;
-            channel.prevModValue = smoothedMod;
-            
-            // Calculate delay in samples
-            // Research suggests 0.5-2ms variation for subtle effect, up to 10ms for extreme
-            float delayVariationMs = smoothedMod * 2.0f; // ±2ms variation at full depth
-            float delaySamples = std::abs(delayVariationMs * 0.001f * static_cast<float>(sampleRate));
-            
-            // Add a base delay to ensure we're always reading from the past
-            float baseDelaySamples = 10.0f; // 10 sample base delay
-            float totalDelaySamples = baseDelaySamples + delaySamples;
-            
-            // Calculate read position
-            float readPos = static_cast<float>(channel.delayWritePos) - totalDelaySamples;
-            while (readPos < 0.0f) readPos += static_cast<float>(channel.delaySize);
-            
-            // Hermite interpolation for smooth pitch shifting
-            int idx0 = static_cast<int>(readPos);
-            float fraction = readPos - static_cast<float>(idx0);
-            
-            // Get 4 points for Hermite interpolation
-            int idx_m1 = (idx0 - 1 + channel.delaySize) % channel.delaySize;
-            int idx_p1 = (idx0 + 1) % channel.delaySize;
-            int idx_p2 = (idx0 + 2) % channel.delaySize;
-            
-            float y_m1 = channel.delayLine[idx_m1];
-            float y0 = channel.delayLine[idx0];
-            float y1 = channel.delayLine[idx_p1];
-            float y2 = channel.delayLine[idx_p2];
-            
-            // Hermite interpolation coefficients
-            float c0 = y0;
-            float c1 = 0.5f * (y1 - y_m1);
-            float c2 = y_m1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
-            float c3 = 0.5f * (y2 - y_m1) + 1.5f * (y0 - y1);
-            
-            // Calculate interpolated output
-            float output = ((c3 * fraction + c2) * fraction + c1) * fraction + c0;
-            
-            // Mix with dry signal based on depth (subtle blending)
-            float wetMix = juce::jlimit(0.0f, 1.0f, depth * 2.0f); // Full wet at 50% depth
-            channelData[sample] = output * wetMix + channelData[sample] * (1.0f - wetMix);
-            
-            // Advance write position
-            channel.delayWritePos = (channel.delayWritePos + 1) % channel.delaySize;
-            
-            // Advance LFO phase
-            channel.lfoPhase += phaseInc;
-            if (channel.lfoPhase >= 1.0)
-                channel.lfoPhase -= 1.0;
+            const double phase = channel.lfoPhase + static_cast<double>(numSamples) * phaseInc;
+            channel.lfoPhase = phase - std::floor(phase);
+            channel.lastModValue = curve[numSegments];
         }
     }
 }
 
-float Wobble::calculateLfoValue(ChannelState& channel, bool useSync, float rateHz) noexcept
+void Wobble::processChannel(ChannelState& channel, float* data, const float* filtered, const float* modulation,
+                            float* delayTimes, int numSamples, float wetMix, DelayInterpolation interpolation) noexcept
 {
-    // Not used in new implementation
-    return 0.0f;
-}
-
-void Wobble::updateDrift(ChannelState& channel, float driftAmount) noexcept
-{
-    // Not used in new implementation  
-}
-
-float Wobble::generateJitter(ChannelState& channel, float jitterAmount) noexcept
-{
-    // Not used in new implementation
-    return 0.0f;
-}
-
-void Wobble::updateTempo(juce::AudioPlayHead* playHead) noexcept
-{
-    // Not used in new implementation
-}
-
-double Wobble::getSyncedFrequency(float rateHz, double bpm) const noexcept
-{
-    // Not used in new implementation
-    return 0.0;
+    // Calculate delay in samples
+    // Research suggests 0.5-2ms variation for subtle effect, up to 10ms for extreme
+    const float samplesPerUnit = 2.0f * 0.001f * static_cast<float>(sampleRate); // ±2ms variation at full depth
+    const float baseDelaySamples = 10.0f; // 10 sample base delay, so even the sinc kernel only reads from the past
+    
+    for (int start = 0, point = 0; start < numSamples; start += controlInterval, ++point)
+    {
+        const int length = juce::jmin(controlInterval, numSamples - start);
+        const float from = modulation[point];
+        const float step = (modulation[point + 1] - from) / static_cast<float>(length);
+        
+        for (int i = 0; i < length; ++i)
+            delayTimes[start + i] = baseDelaySamples + std::abs((from + step * static_cast<float>(i)) * samplesPerUnit);
+    }
+    
+    // Store filtered input in delay line, then read the whole block back interpolated
+    // for smooth pitch shifting; the reads overwrite the delay times
+    channel.delayLine.write(filtered, numSamples);
+    channel.delayLine.read(interpolation, delayTimes, delayTimes, numSamples);
+    
+    for (int sample = 0; sample < numSamples; ++sample)
+        data[sample] = delayTimes[sample] * wetMix + data[sample] * (1.0f - wetMix);
 }
 
 }
\ No newline at end of file
@@ -1,12 +1,21 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../core/ScratchArena.h"
+#include "../core/BlockRandom.h"
+#include "shared/TailTracker.h"
+#include "shared/ChannelPairs.h"
+#include "shared/ChannelLanes.h"
+#include "shared/DelayLine.h"
+#include "shared/QuadratureOscillator.h"
+#include "shared/ControlRateNoise.h"
 
 namespace ReallyCheap
 {
 
 // Forward declaration
 class MacroController;
+struct ParamSnapshot;
 
 class Wobble
 {
@@ -18,52 +27,102 @@ public:
     void reset();
     void process(juce::AudioBuffer<float>& buffer, 
                  juce::AudioPlayHead* playHead, 
-                 juce::AudioProcessorValueTreeState& apvts,
+                 const ParamSnapshot& params,
                  const MacroController& macro) noexcept;
+    
+    // True once the delay line has emptied after the input went silent
+    bool isAsleep() const noexcept { return tailTracker.isSleeping(); }
+    double getTailLengthSeconds() const noexcept;
+    
+    // The right channel of each pair runs 90 degrees behind its left and can be linked to it
+    void setChannelPairs(const ChannelPairs& pairs) noexcept { channelPairs = pairs; }
+    
+    // The jitter noise block is taken from this arena; it must outlive the module
+    void setScratchArena(ScratchArena& arena) noexcept { scratchArena = &arena; }
+    
+    // Jitter is drawn from this generator; it must outlive the module
+    void setBlockRandom(BlockRandom& generator) noexcept { blockRandom = &generator; }
+    
+    // Offline renders always read the delay through the sinc tier, whatever the quality parameter says
+    void setNonRealtime(bool isNonRealtime) noexcept { nonRealtime = isNonRealtime; }
 
 private:
+    // Modulation is worked out once per control interval and interpolated in between
+    static constexpr int controlInterval = 16;
+    
+    // Flutter runs at a fixed multiple of the wow rate
+    static constexpr double flutterRatio = 7.0;
+    
+    // Jitter at the level and bandwidth of the one-pole of 0.98 per sample it used to be at 48 kHz;
+    // drift at the level of the slow sine it replaces
+    static constexpr double jitterCutoffHz = 150.0;
+    static constexpr double jitterRms = 0.058;
+    static constexpr double driftRms = 0.7;
+    
     // Core state
     double sampleRate = 44100.0;
     int numChannels = 2;
+    int maxBlockSize = 512;
+    int maxDelaySamples = 0;
+    bool nonRealtime = false;
+    ChannelPairs channelPairs;
+    ScratchArena* scratchArena = nullptr;
+    BlockRandom* blockRandom = nullptr;
     
     // Simplified channel state for cleaner implementation
     struct ChannelState
     {
-        // LFO phase
+        // LFO phase; the wow and flutter oscillators are anchored to it every block
         double lfoPhase = 0.0;
         
-        // Modulation smoothing
-        float prevModValue = 0.0f;
-        float jitterSmooth = 0.0f;
-        
-        // Circular delay buffer
-        std::vector<float> delayLine;
-        int delayWritePos = 0;
-        int delaySize = 0;
+        // Random modulation, and the modulation the next block starts from
+        ControlRateNoise jitter;
+        ControlRateNoise drift;
+        float lastModValue = 0.0f;
         
-        // Crossfade state for smooth parameter changes
-        float crossfadeAmount = 0.0f;
-        float oldReadPos = 0.0f;
-        float newReadPos = 0.0f;
-        
-        // Anti-aliasing filter state (2nd order Butterworth)
-        float lpf_x1 = 0.0f;
-        float lpf_x2 = 0.0f;
-        float lpf_y1 = 0.0f;
-        float lpf_y2 = 0.0f;
+        // Circular delay buffer, written a block ahead of its reads
+        DelayLine<float> delayLine;
     };
     
     std::vector<ChannelState> channels;
     
-    // Random number generation (RT-safe)
-    juce::Random random;
+    // Modulation at each control point of the block, controlStride per channel, and the
+    // jitter and drift noise drawn for them; both sized in prepare() from the block size
+    std::vector<float> controlModulation;
+    std::vector<float> controlNoise;
+    int controlStride = 0;
+    
+    // Host position the LFOs were last locked to; a sub-block of the same host block repeats it
+    double lastPpqPosition = std::numeric_limits<double>::quiet_NaN();
+    
+    struct ModulationAmounts
+    {
+        float depth = 0.0f;
+        float flutter = 0.0f;
+        float drift = 0.0f;
+        float jitter = 0.0f;
+        float stereoLink = 0.0f;
+        bool mono = false;
+        float driftCutoffHz = 0.0f;
+    };
+    
+    // Anti-aliasing filter (2nd order Butterworth), one per group of laneWidth channels
+    std::vector<LaneBiquad> antiAliasFilters;
+    TailTracker tailTracker;
+    
+    void clearDelayState() noexcept;
+    
+    // Wow cycles per sample. With sync on and the host tempo known, the rate snaps to a power-of-two
+    // division of the beat and, while the transport runs, the LFO phases lock to the playhead.
+    double updateSync(juce::AudioPlayHead* playHead, float rateHz, bool syncOn) noexcept;
+    static double getSyncedCyclesPerBeat(float rateHz, double bpm) noexcept;
+    
+    // Fills controlModulation for numSamples and advances the LFOs and random sources past them
+    void computeModulation(int numSamples, int activeChannels, const ModulationAmounts& amounts, double phaseInc) noexcept;
     
-    // Legacy methods (kept for compatibility but not used)
-    float calculateLfoValue(ChannelState& channel, bool useSync, float rateHz) noexcept;
-    void updateDrift(ChannelState& channel, float driftAmount) noexcept;
-    float generateJitter(ChannelState& channel, float jitterAmount) noexcept;
-    void updateTempo(juce::AudioPlayHead* playHead) noexcept;
-    double getSyncedFrequency(float rateHz, double bpm) const noexcept;
+    // Delay times interpolated from a channel's control points, then the modulated delay itself
+    void processChannel(ChannelState& channel, float* data, const float* filtered, const float* modulation,
+                        float* delayTimes, int numSamples, float wetMix, DelayInterpolation interpolation) noexcept;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Wobble)
 };
@@ -168,40 +168,20 @@ void NoiseAssetManager::loadAssetsFromFolderInternal(const juce::File& folder)
 
 const NoiseAssetManager::AssetBuffer* NoiseAssetManager::getAssetForType(NoiseType type) const noexcept
 {
-    static int getAssetDebugCount = 0;
-    if (getAssetDebugCount < 10)
-    {
-        DBG("getAssetForType called with type: " << static_cast<int>(type));
-        getAssetDebugCount++;
-    }
-    
     auto* assets = assetPointer.load();
     if (!assets)
-    {
-        if (getAssetDebugCount < 10) DBG("  No assets loaded");
         return nullptr;
-    }
     
     auto typeIndex = static_cast<size_t>(type);
     if (typeIndex >= static_cast<size_t>(NoiseType::NumTypes))
-    {
-        if (getAssetDebugCount < 10) DBG("  Invalid type index: " << typeIndex);
         return nullptr;
-    }
     
     auto& collection = assets[typeIndex];
     if (collection.buffers.empty())
-    {
-        if (getAssetDebugCount < 10) DBG("  No assets for type " << static_cast<int>(type));
         return nullptr;
-    }
     
     // Return current buffer (could cycle through multiple if available)
     auto index = collection.currentIndex.load() % collection.buffers.size();
-    if (getAssetDebugCount < 10)
-    {
-        DBG("  Returning asset for type " << static_cast<int>(type) << ": " << collection.buffers[index]->filename);
-    }
     return collection.buffers[index].get();
 }
 
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * AdaaShaper - antiderivative antialiasing for a memoryless waveshaper.
+ *
+ * Instead of f(x[n]), first-order ADAA outputs the mean of f over the line
+ * between the last two inputs, (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1]), and
+ * second-order ADAA the triangle-weighted mean over the last three. That
+ * suppresses most of the aliasing a shaper would otherwise need oversampling
+ * for, at the price of half a sample (first order) or one sample (second
+ * order) of delay.
+ *
+ * The antiderivatives are integrated numerically once, so any shaper works:
+ * F1 is read back with cubic and F2 with quintic Hermite interpolation, both
+ * exact in slope at the nodes. Everything is in double, since the divided
+ * differences of F2 cancel most of its digits. Inputs outside the table range
+ * fall back to f at the matching delay, as ill-conditioned steps do.
+ */
+class AdaaShaper
+{
+public:
+    using Shape = float (*)(float) noexcept;
+
+    // Input history for one channel; reset() whenever the shaper changes
+    struct State
+    {
+        double x1 = 0.0, x2 = 0.0;     // Previous two inputs
+        double f1x1 = 0.0, f2x1 = 0.0; // F1 and F2 at x1, so each step looks up x only
+        double d1 = 0.0;               // Divided difference of F2 over (x1, x2), from the step before
+
+        void reset() noexcept { *this = {}; }
+    };
+
+    static constexpr double defaultRange = 64.0;
+    static constexpr int defaultPointsPerUnit = 32;
+
+    // Allocates and integrates; call once, off the audio thread
+    void build(Shape shapeToUse, double range = defaultRange, int pointsPerUnit = defaultPointsPerUnit)
+    {
+        shape = shapeToUse;
+        limit = range;
+        spacing = 1.0 / pointsPerUnit;
+
+        const int numNodes = 2 * static_cast<int>(range * pointsPerUnit) + 1;
+        nodes.assign(static_cast<size_t>(numNodes), {});
+
+        // Trapezoid sums over a finer grid; the integration constants cancel in the differences
+        constexpr int subSteps = 16;
+        const double subSpacing = spacing / subSteps;
+        const int centre = numNodes / 2;
+
+        auto integrateFrom = [&] (int from, int to)
+        {
+            const int direction = to > from ? 1 : -1;
+            double x = nodeValue(from);
+            double f = shape(static_cast<float>(x));
+            double F1 = nodes[(size_t) from].f1;
+            double F2 = nodes[(size_t) from].f2;
+
+            for (int i = from; i != to; i += direction)
+            {
+                for (int step = 0; step < subSteps; ++step)
+                {
+                    const double nextX = x + direction * subSpacing;
+                    const double nextF = shape(static_cast<float>(nextX));
+                    const double nextF1 = F1 + direction * subSpacing * 0.5 * (f + nextF);
+
+                    F2 += direction * subSpacing * 0.5 * (F1 + nextF1);
+                    x = nextX;
+                    f = nextF;
+                    F1 = nextF1;
+                }
+
+                auto& node = nodes[(size_t) (i + direction)];
+                node.f0 = shape(static_cast<float>(nodeValue(i + direction)));
+                node.f1 = F1;
+                node.f2 = F2;
+            }
+        };
+
+        nodes[(size_t) centre].f0 = shape(0.0f);
+        integrateFrom(centre, numNodes - 1);
+        integrateFrom(centre, 0);
+    }
+
+    float processPlain(float x) const noexcept
+    {
+        return shape(x);
+    }
+
+    float processFirstOrder(State& state, float input) const noexcept
+    {
+        const double x = input;
+        const double x1 = state.x1;
+        const bool inRange = contains(x);
+        const double f1x = inRange ? firstIntegral(x) : 0.0;
+
+        double y;
+        if (inRange && contains(x1) && std::abs(x - x1) > tolerance)
+            y = (f1x - state.f1x1) / (x - x1);
+        else
+            y = shape(static_cast<float>(0.5 * (x + x1)));
+
+        state.x2 = x1;
+        state.x1 = x;
+        state.f1x1 = f1x;
+        return static_cast<float>(y);
+    }
+
+    float processSecondOrder(State& state, float input) const noexcept
+    {
+        const double x = input;
+        const double x1 = state.x1;
+        const double x2 = state.x2;
+        const bool pairInRange = contains(x) && contains(x1);
+        const double f2x = contains(x) ? secondIntegral(x) : 0.0;
+
+        double d0 = 0.0;
+        if (pairInRange)
+            d0 = std::abs(x - x1) > tolerance ? (f2x - state.f2x1) / (x - x1) : firstIntegral(0.5 * (x + x1));
+
+        double y;
+        if (! (pairInRange && contains(x2)))
+        {
+            y = shape(static_cast<float>(x1));
+        }
+        else if (std::abs(x - x2) > tolerance)
+        {
+            y = 2.0 * (d0 - state.d1) / (x - x2);
+        }
+        else
+        {
+            // x and x2 nearly meet, so average around their midpoint instead
+            const double xBar = 0.5 * (x + x2);
+            const double delta = xBar - x1;
+
+            if (std::abs(delta) > tolerance)
+                y = 2.0 / delta * (firstIntegral(xBar) + (state.f2x1 - secondIntegral(xBar)) / delta);
+            else
+                y = shape(static_cast<float>(0.5 * (xBar + x1)));
+        }
+
+        state.x2 = x1;
+        state.x1 = x;
+        state.f2x1 = f2x;
+        state.d1 = d0;
+        return static_cast<float>(y);
+    }
+
+private:
+    struct Node
+    {
+        double f0 = 0.0, f1 = 0.0, f2 = 0.0; // f, F1 and F2 at the node
+    };
+
+    // Below this step the differences of F2 lose too many digits to trust
+    static constexpr double tolerance = 1.0e-3;
+
+    bool contains(double x) const noexcept { return std::abs(x) < limit; }
+    double nodeValue(int index) const noexcept { return -limit + index * spacing; }
+
+    int cellOf(double x, double& t) const noexcept
+    {
+        const double position = (x + limit) / spacing;
+        const int index = juce::jlimit(0, static_cast<int>(nodes.size()) - 2, static_cast<int>(position));
+        t = position - index;
+        return index;
+    }
+
+    double firstIntegral(double x) const noexcept
+    {
+        double t;
+        const auto& a = nodes[(size_t) cellOf(x, t)];
+        const auto& b = (&a)[1];
+        const double t2 = t * t, t3 = t2 * t;
+
+        return (2.0 * t3 - 3.0 * t2 + 1.0) * a.f1 + (t3 - 2.0 * t2 + t) * spacing * a.f0
+             + (3.0 * t2 - 2.0 * t3) * b.f1 + (t3 - t2) * spacing * b.f0;
+    }
+
+    double secondIntegral(double x) const noexcept
+    {
+        double t;
+        const auto& a = nodes[(size_t) cellOf(x, t)];
+        const auto& b = (&a)[1];
+        const double t2 = t * t, t3 = t2 * t, t4 = t3 * t, t5 = t4 * t;
+        const double h = spacing, h2 = spacing * spacing;
+
+        return (1.0 - 10.0 * t3 + 15.0 * t4 - 6.0 * t5) * a.f2
+             + (t - 6.0 * t3 + 8.0 * t4 - 3.0 * t5) * h * a.f1
+             + (0.5 * t2 - 1.5 * t3 + 1.5 * t4 - 0.5 * t5) * h2 * a.f0
+             + (10.0 * t3 - 15.0 * t4 + 6.0 * t5) * b.f2
+             + (-4.0 * t3 + 7.0 * t4 - 3.0 * t5) * h * b.f1
+             + (0.5 * t3 - t4 + 0.5 * t5) * h2 * b.f0;
+    }
+
+    Shape shape = nullptr;
+    double limit = defaultRange;
+    double spacing = 1.0 / defaultPointsPerUnit;
+    std::vector<Node> nodes;
+};
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * BiquadTable - filter coefficients for one control, designed ahead of time.
+ *
+ * prepare() runs the design function (trig, pow, whatever the shape needs) over
+ * an even grid of control values, so the audio thread only ever blends the two
+ * nearest entries. A blend of two stable sections is stable as well: the region
+ * |a2| < 1, |a1| < 1 + a2 is convex. update() remembers the last control value,
+ * so a control that has not moved costs one comparison.
+ *
+ * Entries use the b0, b1, b2, a0, a1, a2 layout of juce::dsp::IIR::ArrayCoefficients
+ * with a0 == 1, so they can be handed to a LaneBiquad or assigned in place to the
+ * coefficients of a juce::dsp::IIR::Filter.
+ */
+class BiquadTable
+{
+public:
+    using Coefficients = std::array<float, 6>;
+
+    static constexpr int defaultSize = 129;
+
+    // Modules move their controls this many samples at a time while they glide
+    static constexpr int subBlockSize = 32;
+
+    // Allocates; call from prepare(). design(value) returns ArrayCoefficients for that control value.
+    template <typename DesignFn>
+    void prepare(float minValue, float maxValue, DesignFn&& design, int numPoints = defaultSize)
+    {
+        jassert(maxValue > minValue && numPoints >= 2);
+
+        rangeStart = minValue;
+        rangeEnd = maxValue;
+        pointsPerUnit = static_cast<float>(numPoints - 1) / (maxValue - minValue);
+
+        table.resize(static_cast<size_t>(numPoints));
+        for (int i = 0; i < numPoints; ++i)
+            table[(size_t) i] = normalise(design(minValue + static_cast<float>(i) / pointsPerUnit));
+
+        lastValue = std::numeric_limits<float>::quiet_NaN(); // The first update() always lands
+        current = table.front();
+    }
+
+    // Coefficients for any value in range, clamped at the ends
+    Coefficients lookup(float value) const noexcept
+    {
+        jassert(! table.empty());
+
+        const float position = (juce::jlimit(rangeStart, rangeEnd, value) - rangeStart) * pointsPerUnit;
+        const int index = juce::jmin(static_cast<int>(position), static_cast<int>(table.size()) - 2);
+        const float fraction = position - static_cast<float>(index);
+
+        const auto& lower = table[(size_t) index];
+        const auto& upper = table[(size_t) index + 1];
+
+        Coefficients result;
+        for (size_t i = 0; i < result.size(); ++i)
+            result[i] = lower[i] + fraction * (upper[i] - lower[i]);
+
+        return result;
+    }
+
+    // Refreshes getCurrent() for a new control value; false if the value has not moved
+    bool update(float value) noexcept
+    {
+        if (value == lastValue)
+            return false;
+
+        lastValue = value;
+        current = lookup(value);
+        return true;
+    }
+
+    const Coefficients& getCurrent() const noexcept { return current; }
+
+private:
+    static Coefficients normalise(const Coefficients& c) noexcept
+    {
+        const float a0Inv = 1.0f / c[3];
+        return { c[0] * a0Inv, c[1] * a0Inv, c[2] * a0Inv, 1.0f, c[4] * a0Inv, c[5] * a0Inv };
+    }
+
+    std::vector<Coefficients> table;
+    Coefficients current { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+    float rangeStart = 0.0f;
+    float rangeEnd = 1.0f;
+    float pointsPerUnit = 1.0f;
+    float lastValue = std::numeric_limits<float>::quiet_NaN();
+};
+
+}
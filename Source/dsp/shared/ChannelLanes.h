@@ -0,0 +1,139 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../core/ScratchArena.h"
+#include <array>
+
+namespace ReallyCheap
+{
+
+/**
+ * ChannelLanes - runs neighbouring channels through one SIMD instruction stream.
+ *
+ * Recursive filters and envelopes cannot vectorise along time, but channels can
+ * share a register: lane i of a LaneVector belongs to channel firstChannel + i.
+ * A group is as wide as the native register (4 floats with SSE/NEON, 8 when
+ * JUCE is built for AVX), so stereo costs one state update instead of two and
+ * a surround bus a handful. Lanes past the last channel carry zeros and are
+ * never written back.
+ */
+using LaneVector = juce::dsp::SIMDRegister<float>;
+using LaneMask = LaneVector::vMaskType;
+
+static constexpr int laneWidth = static_cast<int>(LaneVector::size());
+static constexpr int maxLaneGroups = (ScratchArena::maxChannels + laneWidth - 1) / laneWidth;
+
+inline int getNumLaneGroups(int numChannels) noexcept
+{
+    return (juce::jmax(0, numChannels) + laneWidth - 1) / laneWidth;
+}
+
+// ifTrue where the mask is set, ifFalse elsewhere
+inline LaneVector select(LaneMask mask, LaneVector ifTrue, LaneVector ifFalse) noexcept
+{
+    return (ifTrue & mask) + (ifFalse & ~mask); // One side is +0 in every lane
+}
+
+// NaN and infinity fail x - x == 0
+inline LaneMask isFinite(LaneVector x) noexcept
+{
+    return LaneVector::equal(x - x, LaneVector(0.0f));
+}
+
+// Builds a vector with one value per lane from a function of the channel index
+template <typename Fn>
+LaneVector makeLaneVector(int firstChannel, Fn&& valueForChannel) noexcept
+{
+    alignas(sizeof(LaneVector)) float values[laneWidth];
+    for (int lane = 0; lane < laneWidth; ++lane)
+        values[lane] = valueForChannel(firstChannel + lane);
+
+    return LaneVector::fromRawArray(values);
+}
+
+/** LaneGroup - one frame at a time in and out of a group of buffer channels. */
+class LaneGroup
+{
+public:
+    LaneGroup() noexcept = default;
+
+    // Channels [groupIndex * laneWidth, numChannels) of the buffer, at most laneWidth of them
+    LaneGroup(juce::AudioBuffer<float>& buffer, int groupIndex, int numChannels) noexcept
+        : firstChannel(groupIndex * laneWidth),
+          numLanes(juce::jlimit(0, laneWidth, juce::jmin(numChannels, buffer.getNumChannels()) - groupIndex * laneWidth))
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+            channels[(size_t) lane] = buffer.getWritePointer(firstChannel + lane);
+    }
+
+    int getFirstChannel() const noexcept { return firstChannel; }
+    int getNumLanes() const noexcept { return numLanes; }
+
+    LaneVector load(int sample) const noexcept
+    {
+        alignas(sizeof(LaneVector)) float frame[laneWidth] = {};
+        for (int lane = 0; lane < numLanes; ++lane)
+            frame[lane] = channels[(size_t) lane][sample];
+
+        return LaneVector::fromRawArray(frame);
+    }
+
+    void store(int sample, LaneVector value) noexcept
+    {
+        alignas(sizeof(LaneVector)) float frame[laneWidth];
+        value.copyToRawArray(frame);
+
+        for (int lane = 0; lane < numLanes; ++lane)
+            channels[(size_t) lane][sample] = frame[lane];
+    }
+
+private:
+    std::array<float*, laneWidth> channels {};
+    int firstChannel = 0;
+    int numLanes = 0;
+};
+
+/**
+ * LaneBiquad - one second-order section shared by every lane of a group.
+ *
+ * Same transposed direct form II as juce::dsp::IIR::Filter, so swapping one in
+ * for per-channel filters with equal coefficients leaves the response alone.
+ */
+class LaneBiquad
+{
+public:
+    // Takes the b0, b1, b2, a0, a1, a2 layout of juce::dsp::IIR::ArrayCoefficients
+    void setCoefficients(const std::array<float, 6>& c) noexcept
+    {
+        const float a0Inv = 1.0f / c[3];
+        setCoefficients(c[0] * a0Inv, c[1] * a0Inv, c[2] * a0Inv, c[4] * a0Inv, c[5] * a0Inv);
+    }
+
+    // Already normalised so that a0 == 1
+    void setCoefficients(float newB0, float newB1, float newB2, float newA1, float newA2) noexcept
+    {
+        b0 = newB0; b1 = newB1; b2 = newB2;
+        a1 = newA1; a2 = newA2;
+    }
+
+    void reset() noexcept
+    {
+        s1 = LaneVector(0.0f);
+        s2 = LaneVector(0.0f);
+    }
+
+    LaneVector processSample(LaneVector input) noexcept
+    {
+        const auto output = input * b0 + s1;
+        s1 = input * b1 - output * a1 + s2;
+        s2 = input * b2 - output * a2;
+        return output;
+    }
+
+private:
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    LaneVector s1 { 0.0f };
+    LaneVector s2 { 0.0f };
+};
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../core/ScratchArena.h"
+#include <array>
+
+namespace ReallyCheap
+{
+
+/**
+ * ChannelPairs - maps the stereo-only features onto an N-channel bus.
+ *
+ * Crosstalk, noise width, wobble link and the reverb's phase flip all work on
+ * a left/right pair. On a surround bus each left-side speaker is paired with
+ * its right-side counterpart (L/R, Ls/Rs, Ltf/Rtf...); centre, LFE and other
+ * unmatched channels stay unpaired and are treated as mono. Discrete layouts
+ * such as multitrack stems pair neighbouring channels instead.
+ *
+ * Built on the message thread in prepareToPlay and copied into each module.
+ * Pairs are stored with the lower channel index as "left".
+ */
+class ChannelPairs
+{
+public:
+    static constexpr int maxChannels = ScratchArena::maxChannels;
+
+    ChannelPairs() noexcept { setAdjacentPairs(2); }
+
+    // (0,1), (2,3)...; an odd last channel is left unpaired
+    void setAdjacentPairs(int numChannelsToUse) noexcept
+    {
+        numChannels = juce::jlimit(0, maxChannels, numChannelsToUse);
+        partners.fill(-1);
+        numPairs = 0;
+
+        for (int ch = 0; ch + 1 < numChannels; ch += 2)
+            pair(ch, ch + 1);
+    }
+
+    void setFromChannelSet(const juce::AudioChannelSet& channelSet)
+    {
+        using CT = juce::AudioChannelSet;
+
+        static constexpr std::pair<CT::ChannelType, CT::ChannelType> speakerPairs[] = {
+            { CT::left,              CT::right },
+            { CT::leftCentre,        CT::rightCentre },
+            { CT::leftSurround,      CT::rightSurround },
+            { CT::leftSurroundSide,  CT::rightSurroundSide },
+            { CT::leftSurroundRear,  CT::rightSurroundRear },
+            { CT::wideLeft,          CT::wideRight },
+            { CT::topFrontLeft,      CT::topFrontRight },
+            { CT::topSideLeft,       CT::topSideRight },
+            { CT::topRearLeft,       CT::topRearRight }
+        };
+
+        numChannels = juce::jlimit(0, maxChannels, channelSet.size());
+        partners.fill(-1);
+        numPairs = 0;
+
+        bool foundSpeakerPair = false;
+
+        for (const auto& [leftType, rightType] : speakerPairs)
+        {
+            const int leftIndex = channelSet.getChannelIndexForType(leftType);
+            const int rightIndex = channelSet.getChannelIndexForType(rightType);
+
+            if (juce::isPositiveAndBelow(leftIndex, numChannels) && juce::isPositiveAndBelow(rightIndex, numChannels))
+            {
+                pair(leftIndex, rightIndex);
+                foundSpeakerPair = true;
+            }
+        }
+
+        // Discrete channels carry no speaker positions
+        if (! foundSpeakerPair && numChannels > 1)
+            setAdjacentPairs(numChannels);
+    }
+
+    int getNumChannels() const noexcept { return numChannels; }
+
+    // The other channel of this channel's pair, or -1 if it is unpaired
+    int getPartner(int channel) const noexcept
+    {
+        return juce::isPositiveAndBelow(channel, numChannels) ? partners[(size_t) channel] : -1;
+    }
+
+    // The lower-indexed channel of a pair leads (it is the left one in every JUCE layout);
+    // the other follows it. Unpaired channels lead on their own.
+    bool isRightOfPair(int channel) const noexcept
+    {
+        const int partner = getPartner(channel);
+        return partner >= 0 && partner < channel;
+    }
+
+    struct Pair
+    {
+        int left = 0;
+        int right = 1;
+    };
+
+    int getNumPairs() const noexcept { return numPairs; }
+    const Pair& getPair(int index) const noexcept { return pairs[(size_t) index]; }
+
+    const Pair* begin() const noexcept { return pairs.data(); }
+    const Pair* end() const noexcept { return pairs.data() + numPairs; }
+
+private:
+    void pair(int first, int second) noexcept
+    {
+        if (first > second)
+            std::swap(first, second);
+
+        partners[(size_t) first] = second;
+        partners[(size_t) second] = first;
+        pairs[(size_t) numPairs++] = { first, second };
+    }
+
+    std::array<int, maxChannels> partners {};
+    std::array<Pair, maxChannels / 2> pairs {};
+    int numChannels = 0;
+    int numPairs = 0;
+};
+
+}
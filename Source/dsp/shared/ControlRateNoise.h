@@ -0,0 +1,60 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+
+namespace ReallyCheap
+{
+
+/**
+ * ControlRateNoise - band-limited random modulation, stepped once per control point.
+ *
+ * White noise through two one-pole lowpasses in series, each stepped a whole
+ * control interval at a time. makeStep() works out the coefficient for the
+ * step length and the input gain that holds the output at the requested rms
+ * whatever the cutoff and step, so a short last step in a block does not
+ * change the level. The caller draws the noise, uniform on -1..1, so a block's
+ * worth for every channel can come from one BlockRandom fill.
+ */
+class ControlRateNoise
+{
+public:
+    struct Step
+    {
+        float coefficient = 0.0f;
+        float inputGain = 0.0f;
+    };
+
+    // Constants for steps of stepSamples through a lowpass at cutoffHz, for an output of targetRms
+    static Step makeStep(double cutoffHz, double sampleRate, int stepSamples, double targetRms) noexcept
+    {
+        const double pole = std::exp(-juce::MathConstants<double>::twoPi * cutoffHz * stepSamples / sampleRate);
+
+        // Output power of the pair for unit input gain, with uniform noise carrying a third
+        const double poleSquared = pole * pole;
+        const double oneMinusPoleSquared = 1.0 - poleSquared;
+        const double outputPower = (1.0 - pole) * (1.0 - pole) * (1.0 + poleSquared)
+                                   / (oneMinusPoleSquared * oneMinusPoleSquared * oneMinusPoleSquared) / 3.0;
+
+        return { static_cast<float>(pole), static_cast<float>(targetRms / std::sqrt(outputPower)) };
+    }
+
+    void reset() noexcept
+    {
+        first = 0.0f;
+        second = 0.0f;
+    }
+
+    float next(float noise, const Step& step) noexcept
+    {
+        first = first * step.coefficient + noise * step.inputGain;
+        second = second * step.coefficient + first * (1.0f - step.coefficient);
+        return second;
+    }
+
+private:
+    float first = 0.0f;
+    float second = 0.0f;
+};
+
+}
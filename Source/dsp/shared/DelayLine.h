@@ -0,0 +1,247 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <vector>
+#include "SincTable.h"
+
+namespace ReallyCheap
+{
+
+// How the block reads of a DelayLine fill in between samples, cheapest first
+enum class DelayInterpolation
+{
+    linear,
+    hermite,
+    sinc
+};
+
+/**
+ * DelayLine - circular delay buffer with power-of-two capacity.
+ *
+ * Positions wrap with a mask instead of a modulo or a compare, and the first
+ * guardSamples of the buffer are mirrored past its end, so an interpolated
+ * read of up to a sinc kernel's width, starting anywhere in the buffer, runs
+ * straight on without wrapping.
+ * SampleType is float, or LaneVector to carry a group of channels together.
+ *
+ * Samples go in one at a time with push(), for feedback loops that read
+ * before they write, or a block at a time with write(). The block reads
+ * that follow a write() place each read relative to its own sample in that
+ * block, and work in short chunks of separate passes: read positions, the
+ * gather of the taps, then the interpolation. The first and last passes
+ * vectorize, and the gather is plain loads.
+ */
+template <typename SampleType>
+class DelayLine
+{
+public:
+    static constexpr int guardSamples = SincTable::numTaps;
+
+    // Room for delays up to maxDelaySamples behind a block of up to maxBlockSize written ahead of its reads
+    void prepare(int maxDelaySamples, int maxBlockSize = 1)
+    {
+        capacity = juce::nextPowerOfTwo(juce::jmax(1, maxDelaySamples + maxBlockSize + guardSamples));
+        mask = capacity - 1;
+        buffer.assign(static_cast<size_t>(capacity + guardSamples), SampleType(0.0f));
+        writeIndex = 0;
+    }
+
+    void reset() noexcept
+    {
+        std::fill(buffer.begin(), buffer.end(), SampleType(0.0f));
+        writeIndex = 0;
+    }
+
+    int getCapacity() const noexcept { return capacity; }
+
+    // The sample pushed delaySamples pushes ago, so 1 is the latest
+    SampleType read(int delaySamples) const noexcept
+    {
+        return buffer[static_cast<size_t>((writeIndex - delaySamples) & mask)];
+    }
+
+    void push(SampleType input) noexcept
+    {
+        buffer[static_cast<size_t>(writeIndex)] = input;
+
+        // Mirror the start of the buffer into the guard; rarely taken, so it predicts well
+        if (writeIndex < guardSamples)
+            buffer[static_cast<size_t>(writeIndex + capacity)] = input;
+
+        writeIndex = (writeIndex + 1) & mask;
+    }
+
+    // Appends a block; the block reads then see it as the numSamples most recent samples
+    void write(const SampleType* input, int numSamples) noexcept
+    {
+        const int firstPart = juce::jmin(numSamples, capacity - writeIndex);
+        std::copy(input, input + firstPart, buffer.begin() + writeIndex);
+        std::copy(input + firstPart, input + numSamples, buffer.begin());
+
+        std::copy(buffer.begin(), buffer.begin() + guardSamples, buffer.begin() + capacity);
+        writeIndex = (writeIndex + numSamples) & mask;
+    }
+
+    // Each sample of the block just written, delays[i] samples behind itself, at the given
+    // quality; see the individual reads for the shortest delay each allows
+    void read(DelayInterpolation interpolation, const float* delays, float* output, int numSamples) const noexcept
+    {
+        switch (interpolation)
+        {
+            case DelayInterpolation::linear:  readLinear(delays, output, numSamples); break;
+            case DelayInterpolation::hermite: readHermite(delays, output, numSamples); break;
+            case DelayInterpolation::sinc:    readSinc(delays, output, numSamples); break;
+        }
+    }
+
+    // As read(), by linear interpolation; delays from 0 upwards
+    void readLinear(const float* delays, float* output, int numSamples) const noexcept
+    {
+        const float* data = buffer.data();
+        const int firstSample = writeIndex - numSamples + capacity;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+            int older[chunkSize];
+            float fraction[chunkSize];
+            float y0[chunkSize], y1[chunkSize];
+
+            for (int i = 0; i < count; ++i)
+            {
+                const float delay = delays[start + i];
+                const int whole = static_cast<int>(delay);
+                fraction[i] = delay - static_cast<float>(whole);
+                older[i] = (firstSample + start + i - whole - 1) & mask;
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                y0[i] = data[older[i]];
+                y1[i] = data[older[i] + 1];
+            }
+
+            for (int i = 0; i < count; ++i)
+                output[start + i] = y1[i] + fraction[i] * (y0[i] - y1[i]);
+        }
+    }
+
+    // As read(), by four-point Hermite interpolation; delays of at least 1
+    void readHermite(const float* delays, float* output, int numSamples) const noexcept
+    {
+        const float* data = buffer.data();
+        const int firstSample = writeIndex - numSamples + capacity;
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+            int base[chunkSize];
+            float position[chunkSize];
+            float ym1[chunkSize], y0[chunkSize], y1[chunkSize], y2[chunkSize];
+
+            // The read point lies between the samples whole + 1 and whole behind; Hermite
+            // takes one more either side, starting two samples past whole
+            for (int i = 0; i < count; ++i)
+            {
+                const float delay = delays[start + i];
+                const int whole = static_cast<int>(delay);
+                position[i] = 1.0f - (delay - static_cast<float>(whole));
+                base[i] = (firstSample + start + i - whole - 2) & mask;
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                const float* taps = data + base[i];
+                ym1[i] = taps[0];
+                y0[i] = taps[1];
+                y1[i] = taps[2];
+                y2[i] = taps[3];
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                const float c1 = 0.5f * (y1[i] - ym1[i]);
+                const float c2 = ym1[i] - 2.5f * y0[i] + 2.0f * y1[i] - 0.5f * y2[i];
+                const float c3 = 0.5f * (y2[i] - ym1[i]) + 1.5f * (y0[i] - y1[i]);
+                const float t = position[i];
+                output[start + i] = ((c3 * t + c2) * t + c1) * t + y0[i];
+            }
+        }
+    }
+
+    // As read(), through SincTable's windowed sinc; delays of at least SincTable::numTaps / 2
+    void readSinc(const float* delays, float* output, int numSamples) const noexcept
+    {
+        const float* data = buffer.data();
+        const SincTable& table = SincTable::get();
+        const int firstSample = writeIndex - numSamples + capacity;
+        constexpr int numTaps = SincTable::numTaps;
+        constexpr float phaseScale = static_cast<float>(SincTable::numPhases);
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+            int base[chunkSize], phase[chunkSize];
+            float phaseFraction[chunkSize];
+
+            // The read point lies between the samples whole + 1 and whole behind, which sit
+            // either side of the middle of the kernel
+            for (int i = 0; i < count; ++i)
+            {
+                const float delay = delays[start + i];
+                const int whole = static_cast<int>(delay);
+                const float scaledPhase = (1.0f - (delay - static_cast<float>(whole))) * phaseScale;
+                phase[i] = static_cast<int>(scaledPhase);
+                phaseFraction[i] = scaledPhase - static_cast<float>(phase[i]);
+                base[i] = (firstSample + start + i - whole - numTaps / 2) & mask;
+            }
+
+            // Fixed-length dot products, one per output, across the taps
+            for (int i = 0; i < count; ++i)
+            {
+                const float* taps = data + base[i];
+                const float* row = table.getRow(phase[i]);
+                const float blend = phaseFraction[i];
+                float sum = 0.0f;
+
+                for (int tap = 0; tap < numTaps; ++tap)
+                    sum += (row[tap] + blend * row[numTaps + tap]) * taps[tap];
+
+                output[start + i] = sum;
+            }
+        }
+    }
+
+    // The block just written, delaySamples behind (0 upwards), by linear interpolation
+    void readLinear(float delaySamples, float* output, int numSamples) const noexcept
+    {
+        const float* data = buffer.data();
+        const int whole = static_cast<int>(delaySamples);
+        const float fraction = delaySamples - static_cast<float>(whole);
+
+        // One contiguous run up to the end of the buffer, where the guard holds the next sample
+        int older = (writeIndex - numSamples - whole - 1) & mask;
+        for (int done = 0; done < numSamples;)
+        {
+            const int run = juce::jmin(numSamples - done, capacity - older);
+            const float* from = data + older;
+
+            for (int i = 0; i < run; ++i)
+                output[done + i] = from[i + 1] + fraction * (from[i] - from[i + 1]);
+
+            done += run;
+            older = 0;
+        }
+    }
+
+private:
+    static constexpr int chunkSize = 64;
+
+    std::vector<SampleType> buffer;
+    int capacity = 0;
+    int mask = 0;
+    int writeIndex = 0;
+};
+
+}
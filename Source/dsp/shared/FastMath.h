@@ -0,0 +1,58 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+
+namespace ReallyCheap
+{
+
+/**
+ * Branch-free helpers for per-sample loops that should vectorize.
+ *
+ * Without -ffinite-math-only, GCC will not turn a float min/max or clamp
+ * written with ?: (which is all jmin, jmax and jlimit are) into vector
+ * min/max, and the whole loop stays scalar. abs and copysign are plain bit
+ * operations, so the helpers here are built from those instead.
+ */
+
+// max(x, 0), exact for either sign
+inline float positivePart(float x) noexcept
+{
+    return 0.5f * (x + std::abs(x));
+}
+
+// Numerator and denominator of tanh's [7/6] Padé approximant, with the input magnitude clamped
+// where the approximant reaches 1
+inline void tanhPadeTerms(float x, float& numerator, float& denominator) noexcept
+{
+    constexpr float limit = 4.97f;
+
+    const float magnitude = std::abs(x);
+    const float clamped = std::copysign(magnitude - positivePart(magnitude - limit), x);
+    const float x2 = clamped * clamped;
+
+    numerator = clamped * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    denominator = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+}
+
+/**
+ * tanh as its [7/6] Padé approximant, clamped so it saturates cleanly
+ * instead of overshooting. The maximum error against std::tanh is just
+ * under 1e-4, close to the clamp.
+ */
+inline float fastTanh(float x) noexcept
+{
+    float numerator, denominator;
+    tanhPadeTerms(x, numerator, denominator);
+    return numerator / denominator;
+}
+
+// 1 / fastTanh(x) in a single divide, for x away from 0
+inline float fastCoth(float x) noexcept
+{
+    float numerator, denominator;
+    tanhPadeTerms(x, numerator, denominator);
+    return denominator / numerator;
+}
+
+}
@@ -0,0 +1,422 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "MinimumPhase.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * HalfbandOversampler - 2x, 4x, 8x or 16x oversampling through cascaded
+ * polyphase halfband FIR stages.
+ *
+ * Each stage doubles the rate with a Kaiser-windowed halfband lowpass, split
+ * into its even and odd phases so every tap runs at the lower rate. In the
+ * linear-phase design every other tap is zero and the odd phase is a bare
+ * delay, so a stage costs half a filter per output sample; the minimum-phase
+ * design keeps the same magnitude response with far less delay but needs both
+ * phases in full.
+ *
+ * The passband ends at 0.45 of the host rate for every stage, so only the
+ * first one needs a narrow transition; the later ones have images far away
+ * and get short filters. As in juce::dsp::Oversampling at maximum quality,
+ * each stage after the first may reject 10 dB less than the one before.
+ *
+ * The oversampled signal is padded at the top rate until the round trip is a
+ * whole number of host samples, so getLatencySamples() is exact for linear
+ * phase and within half an oversampled sample for minimum phase, without the
+ * fractional delay filter JUCE needs for the same.
+ *
+ * Taps are stored reversed and each history is kept linear rather than as a
+ * ring, so a phase runs as one tap after another over the whole block: every
+ * step is a contiguous multiply-add across neighbouring outputs, which
+ * vectorizes without a horizontal sum per output.
+ */
+class HalfbandOversampler
+{
+public:
+    enum class Phase
+    {
+        linear,
+        minimum
+    };
+
+    static constexpr int maxStages = 4;
+    static constexpr double defaultStopbandDb = 90.0;
+
+    // Designs the stages and allocates every buffer; call off the audio thread
+    void prepare(int numChannels, int maxBlockSize, int numStages, Phase phase, double stopbandDb = defaultStopbandDb)
+    {
+        channels = numChannels;
+        maxBlock = maxBlockSize;
+        stages.clear();
+        stages.resize((size_t) juce::jlimit(0, maxStages, numStages));
+
+        const int numStagesUsed = static_cast<int>(stages.size());
+        double topRateDelay = 0.0;
+
+        for (int s = 0; s < numStagesUsed; ++s)
+        {
+            auto& stage = stages[(size_t) s];
+            const double attenuation = juce::jmax(minimumStopbandDb, stopbandDb - stageRelaxationDb * s);
+            const double transition = 0.5 - passbandEdge / static_cast<double>(1 << s);
+
+            auto taps = designHalfband(attenuation, transition);
+            const int halfLength = static_cast<int>(taps.size() + 1) / 4;
+            double delay = 0.5 * static_cast<double>(taps.size() - 1);
+
+            stage.halfband = phase == Phase::linear;
+            if (! stage.halfband)
+            {
+                taps = MinimumPhase::fromTaps(taps, minimumPhaseFftSize, static_cast<int>(taps.size()));
+                delay = normaliseAndMeasureDelay(taps);
+            }
+
+            // Even taps are h[0], h[2], ...; odd taps h[1], h[3], ...
+            const int evenLength = static_cast<int>(taps.size() + 1) / 2;
+            stage.length = evenLength;
+            stage.centreIndex = stage.length - halfLength;
+            stage.evenTaps.assign((size_t) stage.length, 0.0f);
+            stage.oddTaps.assign((size_t) stage.length, 0.0f);
+
+            for (size_t n = 0; n < taps.size(); ++n)
+            {
+                auto& branch = (n % 2 == 0) ? stage.evenTaps : stage.oddTaps;
+                branch[(size_t) stage.length - 1 - n / 2] = static_cast<float>(taps[n]);
+            }
+
+            const int inputSize = maxBlockSize << s;
+            stage.output.setSize(numChannels, inputSize * 2);
+            stage.upHistory.setSize(numChannels, stage.length + inputSize);
+            stage.downEven.setSize(numChannels, stage.length + inputSize);
+            stage.downOdd.setSize(numChannels, stage.length + inputSize);
+
+            // Up and down each delay by the filter's group delay at the stage's output rate
+            topRateDelay += 2.0 * delay * static_cast<double>(1 << (numStagesUsed - 1 - s));
+        }
+
+        const int factor = getFactor();
+        const int roundedDelay = juce::roundToInt(topRateDelay);
+        padSamples = (factor - roundedDelay % factor) % factor;
+        latencySamples = (roundedDelay + padSamples) / factor;
+        padHistory.setSize(numChannels, padSamples + maxBlockSize * factor);
+        evenScratch.assign((size_t) (maxBlockSize * factor / 2), 0.0f);
+        oddScratch.assign(evenScratch.size(), 0.0f);
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto& stage : stages)
+        {
+            stage.output.clear();
+            stage.upHistory.clear();
+            stage.downEven.clear();
+            stage.downOdd.clear();
+        }
+
+        padHistory.clear();
+    }
+
+    int getFactor() const noexcept { return 1 << static_cast<int>(stages.size()); }
+
+    // Round-trip delay in host samples
+    int getLatencySamples() const noexcept { return latencySamples; }
+
+    // Upsamples into internal storage and returns it; process it in place, then call processSamplesDown()
+    juce::dsp::AudioBlock<float> processSamplesUp(const juce::dsp::AudioBlock<float>& input) noexcept
+    {
+        if (stages.empty())
+            return input;
+
+        const int numSamples = static_cast<int>(input.getNumSamples());
+        const int numChannelsUsed = juce::jmin(static_cast<int>(input.getNumChannels()), channels);
+        jassert(numSamples <= maxBlock);
+
+        for (int ch = 0; ch < numChannelsUsed; ++ch)
+        {
+            const float* source = input.getChannelPointer((size_t) ch);
+            int n = numSamples;
+
+            for (auto& stage : stages)
+            {
+                float* dest = stage.output.getWritePointer(ch);
+                upsample(stage, ch, source, dest, n);
+                source = dest;
+                n *= 2;
+            }
+        }
+
+        return { stages.back().output.getArrayOfWritePointers(), (size_t) numChannelsUsed,
+                 (size_t) (numSamples * getFactor()) };
+    }
+
+    // Decimates the block processSamplesUp() returned back into output
+    void processSamplesDown(juce::dsp::AudioBlock<float>& output) noexcept
+    {
+        if (stages.empty())
+            return;
+
+        const int numSamples = static_cast<int>(output.getNumSamples());
+        const int numChannelsUsed = juce::jmin(static_cast<int>(output.getNumChannels()), channels);
+        const int numStagesUsed = static_cast<int>(stages.size());
+
+        for (int ch = 0; ch < numChannelsUsed; ++ch)
+        {
+            int n = numSamples * getFactor();
+            float* top = stages.back().output.getWritePointer(ch);
+            padToWholeSamples(ch, top, n);
+
+            const float* source = top;
+            for (int s = numStagesUsed - 1; s >= 0; --s)
+            {
+                n /= 2;
+                float* dest = s > 0 ? stages[(size_t) s - 1].output.getWritePointer(ch)
+                                    : output.getChannelPointer((size_t) ch);
+                downsample(stages[(size_t) s], ch, source, dest, n);
+                source = dest;
+            }
+        }
+    }
+
+private:
+    struct Stage
+    {
+        int length = 0;       // Taps per phase
+        int centreIndex = 0;  // Where the odd phase's lone tap reads in a window, for halfband stages
+        bool halfband = true; // Odd phase is a single tap of 0.5
+        std::vector<float> evenTaps, oddTaps; // Reversed, so a window dots with them front to back
+
+        juce::AudioBuffer<float> output;    // This stage's upsampled signal
+        juce::AudioBuffer<float> upHistory; // length past inputs, then the block
+        juce::AudioBuffer<float> downEven, downOdd;
+    };
+
+    static constexpr double passbandEdge = 0.45; // Fraction of the host rate kept flat
+    static constexpr double stageRelaxationDb = 10.0;
+    static constexpr double minimumStopbandDb = 40.0;
+    static constexpr int minimumPhaseFftSize = 16384;
+    static constexpr int maxHalfLength = 256;
+
+    // Kaiser-windowed halfband lowpass of length 4K - 1, with its transition band (a fraction
+    // of its own sample rate) centred on a quarter of that rate. Kaiser's length estimate runs
+    // a few dB short for halfbands, so it is a starting point that grows until the stopband is met.
+    static std::vector<double> designHalfband(double attenuationDb, double transition)
+    {
+        const int estimate = static_cast<int>(std::ceil((attenuationDb - 7.95) / (14.36 * transition))) + 1;
+        const double requiredPeak = juce::Decibels::decibelsToGain(-attenuationDb, -400.0);
+
+        for (int halfLength = juce::jmax(2, (estimate + 4) / 4);; ++halfLength)
+        {
+            auto taps = kaiserHalfband(halfLength, attenuationDb);
+            if (stopbandPeak(taps, 0.25 + 0.5 * transition) <= requiredPeak || halfLength >= maxHalfLength)
+                return taps;
+        }
+    }
+
+    static std::vector<double> kaiserHalfband(int halfLength, double attenuationDb)
+    {
+        const double pi = juce::MathConstants<double>::pi;
+        const int numTaps = 4 * halfLength - 1;
+        const int centre = 2 * halfLength - 1;
+
+        const double beta = attenuationDb > 50.0 ? 0.1102 * (attenuationDb - 8.7)
+                                                 : 0.5842 * std::pow(attenuationDb - 21.0, 0.4) + 0.07886 * (attenuationDb - 21.0);
+
+        std::vector<double> taps((size_t) numTaps, 0.0);
+        double sideSum = 0.0;
+
+        for (int n = 0; n < numTaps; ++n)
+        {
+            const int offset = n - centre;
+            if (offset == 0 || offset % 2 == 0)
+                continue;
+
+            const double position = static_cast<double>(offset) / centre;
+            const double window = besselI0(beta * std::sqrt(1.0 - position * position)) / besselI0(beta);
+            taps[(size_t) n] = std::sin(0.5 * pi * offset) / (pi * offset) * window;
+            sideSum += taps[(size_t) n];
+        }
+
+        // Both phases sum to exactly a half, so DC passes without a ripple at the top rate
+        for (auto& tap : taps)
+            tap *= 0.5 / sideSum;
+
+        taps[(size_t) centre] = 0.5;
+        return taps;
+    }
+
+    // Largest magnitude response from stopbandStart to Nyquist, on a grid fine enough for these lengths
+    static double stopbandPeak(const std::vector<double>& taps, double stopbandStart)
+    {
+        constexpr int numPoints = 512;
+        double peak = 0.0;
+
+        for (int point = 0; point <= numPoints; ++point)
+        {
+            const double frequency = stopbandStart + (0.5 - stopbandStart) * point / numPoints;
+            const double step = juce::MathConstants<double>::twoPi * frequency;
+            double re = 0.0, im = 0.0;
+
+            for (size_t n = 0; n < taps.size(); ++n)
+            {
+                re += taps[n] * std::cos(step * static_cast<double>(n));
+                im -= taps[n] * std::sin(step * static_cast<double>(n));
+            }
+
+            peak = juce::jmax(peak, std::sqrt(re * re + im * im));
+        }
+
+        return peak;
+    }
+
+    // Scales taps to unity gain at DC and returns their group delay there
+    static double normaliseAndMeasureDelay(std::vector<double>& taps)
+    {
+        double sum = 0.0, moment = 0.0;
+        for (size_t n = 0; n < taps.size(); ++n)
+        {
+            sum += taps[n];
+            moment += static_cast<double>(n) * taps[n];
+        }
+
+        for (auto& tap : taps)
+            tap /= sum;
+
+        return moment / sum;
+    }
+
+    static double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 64 && term > 1.0e-12 * sum; ++k)
+        {
+            term *= (0.5 * x / k) * (0.5 * x / k);
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    // sums[i] = window[i] * taps[0] + window[i + 1] * taps[1] + ... for n outputs. Going tap by
+    // tap over the whole run keeps the lanes on neighbouring outputs, with no horizontal sums,
+    // and taking four taps a pass saves most of the loads and stores of the sums.
+    static void filterRun(const float* window, const float* taps, int length, float* sums, int n) noexcept
+    {
+        std::fill(sums, sums + n, 0.0f);
+
+        int j = 0;
+        for (; j + 4 <= length; j += 4)
+        {
+            const float t0 = taps[j], t1 = taps[j + 1], t2 = taps[j + 2], t3 = taps[j + 3];
+            const float* x = window + j;
+
+            for (int i = 0; i < n; ++i)
+                sums[i] += (t0 * x[i] + t1 * x[i + 1]) + (t2 * x[i + 2] + t3 * x[i + 3]);
+        }
+
+        for (; j < length; ++j)
+        {
+            const float tap = taps[j];
+            const float* x = window + j;
+
+            for (int i = 0; i < n; ++i)
+                sums[i] += tap * x[i];
+        }
+    }
+
+    // n inputs to 2n outputs; the window for input i ends on it
+    void upsample(Stage& stage, int ch, const float* input, float* output, int n) noexcept
+    {
+        const int length = stage.length;
+        float* history = stage.upHistory.getWritePointer(ch);
+        std::copy(input, input + n, history + length);
+
+        float* evenSums = evenScratch.data();
+        filterRun(history + 1, stage.evenTaps.data(), length, evenSums, n);
+
+        if (stage.halfband)
+        {
+            const float* centre = history + 1 + stage.centreIndex;
+            for (int i = 0; i < n; ++i)
+            {
+                output[2 * i] = 2.0f * evenSums[i];
+                output[2 * i + 1] = centre[i];
+            }
+        }
+        else
+        {
+            float* oddSums = oddScratch.data();
+            filterRun(history + 1, stage.oddTaps.data(), length, oddSums, n);
+
+            for (int i = 0; i < n; ++i)
+            {
+                output[2 * i] = 2.0f * evenSums[i];
+                output[2 * i + 1] = 2.0f * oddSums[i];
+            }
+        }
+
+        std::copy(history + n, history + n + length, history);
+    }
+
+    // 2n inputs to n outputs: the even phase filters input 2i and back, the odd phase input 2i - 1 and back
+    void downsample(Stage& stage, int ch, const float* input, float* output, int n) noexcept
+    {
+        const int length = stage.length;
+        float* even = stage.downEven.getWritePointer(ch);
+        float* odd = stage.downOdd.getWritePointer(ch);
+
+        for (int i = 0; i < n; ++i)
+        {
+            even[length + i] = input[2 * i];
+            odd[length + i] = input[2 * i + 1];
+        }
+
+        float* evenSums = evenScratch.data();
+        filterRun(even + 1, stage.evenTaps.data(), length, evenSums, n);
+
+        if (stage.halfband)
+        {
+            const float* centre = odd + stage.centreIndex;
+            for (int i = 0; i < n; ++i)
+                output[i] = evenSums[i] + 0.5f * centre[i];
+        }
+        else
+        {
+            float* oddSums = oddScratch.data();
+            filterRun(odd, stage.oddTaps.data(), length, oddSums, n);
+
+            for (int i = 0; i < n; ++i)
+                output[i] = evenSums[i] + oddSums[i];
+        }
+
+        std::copy(even + n, even + n + length, even);
+        std::copy(odd + n, odd + n + length, odd);
+    }
+
+    // Delays the top-rate signal by padSamples so the round trip is whole host samples
+    void padToWholeSamples(int ch, float* data, int n) noexcept
+    {
+        if (padSamples == 0)
+            return;
+
+        float* history = padHistory.getWritePointer(ch);
+        std::copy(data, data + n, history + padSamples);
+        std::copy(history, history + n, data);
+        std::copy(history + n, history + n + padSamples, history);
+    }
+
+    std::vector<Stage> stages;
+    juce::AudioBuffer<float> padHistory;
+    std::vector<float> evenScratch, oddScratch; // Per-phase sums for the stage being run
+    int channels = 0;
+    int maxBlock = 0;
+    int padSamples = 0;
+    int latencySamples = 0;
+};
+
+}
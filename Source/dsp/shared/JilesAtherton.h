@@ -0,0 +1,238 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include "ChannelLanes.h"
+#include "FastMath.h"
+
+namespace ReallyCheap
+{
+
+// How JilesAtherton steps its differential equation, cheapest first
+enum class HysteresisSolver
+{
+    rk2,     // Explicit midpoint, two slope evaluations
+    rk4,     // Classic Runge-Kutta, four
+    newton4, // Implicit trapezoidal rule by four Newton-Raphson iterations, five
+    newton8  // The same with eight iterations, nine
+};
+
+/**
+ * JilesAtherton - magnetic hysteresis of tape, a group of channels at a time.
+ *
+ * The input is the applied field H and the output the magnetisation M, both
+ * scaled so that M saturates at 1. The Jiles-Atherton model gives dM/dH from
+ * the Langevin anhysteretic curve and the direction the field is moving in;
+ * it is stepped once per sample with the field's rate of change taken by an
+ * alpha-transform differentiator, which unlike the bilinear one does not ring
+ * at Nyquist. Every solver runs a fixed number of slope evaluations, so the
+ * cost per sample is the same whatever the signal.
+ *
+ * juce::dsp::SIMDRegister has no divide, so the lanes are worked on as plain
+ * arrays of laneWidth floats, the same branch-free code for each, which the
+ * compiler turns back into vector instructions. The Langevin function comes
+ * from fastCoth, with its series near zero where coth(q) - 1/q cancels.
+ *
+ * The model is stiff enough to alias badly at the host rate; run it at 2x or
+ * more.
+ */
+class JilesAtherton
+{
+public:
+    void prepare(double sampleRate) noexcept
+    {
+        samplePeriod = static_cast<float>(1.0 / sampleRate);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (int lane = 0; lane < laneWidth; ++lane)
+        {
+            magnetisation[lane] = 0.0f;
+            lastField[lane] = 0.0f;
+            lastFieldRate[lane] = 0.0f;
+        }
+    }
+
+    LaneVector processSample(LaneVector field, HysteresisSolver solver) noexcept
+    {
+        alignas(sizeof(LaneVector)) float fields[laneWidth];
+        field.copyToRawArray(fields);
+
+        switch (solver)
+        {
+            case HysteresisSolver::rk2:     stepRungeKutta2(fields); break;
+            case HysteresisSolver::rk4:     stepRungeKutta4(fields); break;
+            case HysteresisSolver::newton4: stepNewton<4>(fields); break;
+            case HysteresisSolver::newton8: stepNewton<8>(fields); break;
+        }
+
+        return LaneVector::fromRawArray(magnetisation);
+    }
+
+private:
+    // Tape constants after ChowTape's defaults, with the saturation magnetisation scaled to 1
+    static constexpr float inverseShape = 3.0f;         // 1 / a: the anhysteretic curve's small-signal slope is 1
+    static constexpr float coupling = 1.6e-3f;          // alpha: inter-domain coupling
+    static constexpr float pinning = 0.47875f;          // k: how wide the loop opens
+    static constexpr float reversibility = 0.7f;        // c: share of the response that retraces itself
+    static constexpr float differentiatorAlpha = 0.75f; // 1 would be the bilinear transform
+
+    struct Slope
+    {
+        float rate = 0.0f;       // dM/dt
+        float derivative = 0.0f; // d(dM/dt)/dM, for Newton-Raphson
+    };
+
+    // dM/dt at magnetisation m, field h moving at fieldRate; inlined into the lane loops, where
+    // the derivative is dropped unless a Newton step asks for it
+    static Slope slope(float m, float h, float fieldRate) noexcept
+    {
+        const float q = (h + coupling * m) * inverseShape;
+
+        // Langevin function L(q) = coth(q) - 1/q and its first two derivatives. The closed
+        // forms cancel to nothing near zero, where the series takes over. Both are worked out
+        // and blended by a weight of 0 or 1: GCC will not vectorize a ?: that picks a quotient.
+        const float q2 = q * q;
+        const float nearZero = std::abs(q) < 0.25f ? 1.0f : 0.0f;
+        const float safeQ = q + nearZero * (0.25f - q);
+        const float inverseQ = 1.0f / safeQ;
+        const float coth = fastCoth(safeQ);
+        const float inverseSinhSquared = coth * coth - 1.0f;
+
+        const float closedLangevin = coth - inverseQ;
+        const float closedLangevin1 = inverseQ * inverseQ - inverseSinhSquared;
+        const float closedLangevin2 = 2.0f * (coth * inverseSinhSquared - inverseQ * inverseQ * inverseQ);
+        const float seriesLangevin = q * (1.0f / 3.0f - q2 * (1.0f / 45.0f - q2 * (2.0f / 945.0f)));
+        const float seriesLangevin1 = 1.0f / 3.0f - q2 * (1.0f / 15.0f - q2 * (2.0f / 189.0f));
+        const float seriesLangevin2 = q * (-2.0f / 15.0f + q2 * (8.0f / 189.0f));
+
+        const float langevin = closedLangevin + nearZero * (seriesLangevin - closedLangevin);
+        const float langevin1 = closedLangevin1 + nearZero * (seriesLangevin1 - closedLangevin1);
+        const float langevin2 = closedLangevin2 + nearZero * (seriesLangevin2 - closedLangevin2);
+
+        // Irreversible part: only while the field pulls m towards the anhysteretic curve
+        const float offset = langevin - m;
+        const float direction = std::copysign(1.0f, fieldRate);
+        const float pinned = direction * offset > 0.0f ? 1.0f - reversibility : 0.0f;
+        const float irreversibleDenominator = (1.0f - reversibility) * direction * pinning - coupling * offset;
+
+        // Reversible part, and the feedback of m into the effective field
+        const float reversible = reversibility * inverseShape * langevin1;
+        const float feedback = 1.0f - reversibility * coupling * inverseShape * langevin1;
+
+        // Both quotients over one divide, which sits on the path from one sample to the next
+        const float inverseDenominator = 1.0f / (irreversibleDenominator * feedback);
+        const float inverseIrreversibleDenominator = feedback * inverseDenominator;
+        const float inverseFeedback = irreversibleDenominator * inverseDenominator;
+        const float response = (pinned * offset + reversible * irreversibleDenominator) * inverseIrreversibleDenominator;
+        const float rate = fieldRate * response * inverseFeedback;
+
+        // The same differentiated by m, through q and the offset
+        const float qPerM = coupling * inverseShape;
+        const float offsetPerM = langevin1 * qPerM - 1.0f;
+        const float irreversiblePerM = pinned * offsetPerM * (1.0f - reversibility) * direction * pinning
+                                       * inverseIrreversibleDenominator * inverseIrreversibleDenominator;
+        const float reversiblePerM = reversibility * inverseShape * langevin2 * qPerM;
+        const float feedbackPerM = -reversibility * coupling * inverseShape * langevin2 * qPerM;
+        const float derivative = fieldRate * ((irreversiblePerM + reversiblePerM) * feedback - response * feedbackPerM)
+                                 * inverseFeedback * inverseFeedback;
+
+        return { rate, derivative };
+    }
+
+    // Rate of change of the field by the alpha transform
+    float fieldRateAt(float field, int lane) const noexcept
+    {
+        return (1.0f + differentiatorAlpha) / samplePeriod * (field - lastField[lane])
+               - differentiatorAlpha * lastFieldRate[lane];
+    }
+
+    // Keeps the new magnetisation and field. The exact solution never passes saturation, but a
+    // step through a field jump far beyond it can, so m is held to +-1; a NaN lands there too.
+    void finishStep(int lane, float m, float field, float fieldRate) noexcept
+    {
+        magnetisation[lane] = std::abs(m) <= 1.0f ? m : std::copysign(1.0f, m);
+        lastField[lane] = field;
+        lastFieldRate[lane] = fieldRate;
+    }
+
+    void stepRungeKutta2(const float* fields) noexcept
+    {
+        for (int lane = 0; lane < laneWidth; ++lane)
+        {
+            const float m = magnetisation[lane];
+            const float h = lastField[lane];
+            const float rate = lastFieldRate[lane];
+            const float field = fields[lane];
+            const float fieldRate = fieldRateAt(field, lane);
+            const float midField = 0.5f * (h + field);
+            const float midRate = 0.5f * (rate + fieldRate);
+
+            const float k1 = samplePeriod * slope(m, h, rate).rate;
+            const float k2 = samplePeriod * slope(m + 0.5f * k1, midField, midRate).rate;
+
+            finishStep(lane, m + k2, field, fieldRate);
+        }
+    }
+
+    void stepRungeKutta4(const float* fields) noexcept
+    {
+        for (int lane = 0; lane < laneWidth; ++lane)
+        {
+            const float m = magnetisation[lane];
+            const float h = lastField[lane];
+            const float rate = lastFieldRate[lane];
+            const float field = fields[lane];
+            const float fieldRate = fieldRateAt(field, lane);
+            const float midField = 0.5f * (h + field);
+            const float midRate = 0.5f * (rate + fieldRate);
+
+            const float k1 = samplePeriod * slope(m, h, rate).rate;
+            const float k2 = samplePeriod * slope(m + 0.5f * k1, midField, midRate).rate;
+            const float k3 = samplePeriod * slope(m + 0.5f * k2, midField, midRate).rate;
+            const float k4 = samplePeriod * slope(m + k3, field, fieldRate).rate;
+
+            finishStep(lane, m + (k1 + 2.0f * (k2 + k3) + k4) * (1.0f / 6.0f), field, fieldRate);
+        }
+    }
+
+    // Solves m = m1 + T/2 (f(m1) + f(m)) from an explicit Euler guess. The lanes are the inner
+    // loop, each iteration one pass across them, so that it vectorizes.
+    template <int iterations>
+    void stepNewton(const float* fields) noexcept
+    {
+        const float halfPeriod = 0.5f * samplePeriod;
+        float m[laneWidth], start[laneWidth], fieldRates[laneWidth];
+
+        for (int lane = 0; lane < laneWidth; ++lane)
+        {
+            const float m1 = magnetisation[lane];
+            const float lastRate = slope(m1, lastField[lane], lastFieldRate[lane]).rate;
+            fieldRates[lane] = fieldRateAt(fields[lane], lane);
+            start[lane] = m1 + halfPeriod * lastRate;
+            m[lane] = m1 + samplePeriod * lastRate;
+        }
+
+        for (int iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (int lane = 0; lane < laneWidth; ++lane)
+            {
+                const auto current = slope(m[lane], fields[lane], fieldRates[lane]);
+                const float residual = m[lane] - start[lane] - halfPeriod * current.rate;
+                m[lane] -= residual / (1.0f - halfPeriod * current.derivative);
+            }
+        }
+
+        for (int lane = 0; lane < laneWidth; ++lane)
+            finishStep(lane, m[lane], fields[lane], fieldRates[lane]);
+    }
+
+    float samplePeriod = 1.0f / 44100.0f;
+    alignas(sizeof(LaneVector)) float magnetisation[laneWidth] = {};
+    float lastField[laneWidth] = {};
+    float lastFieldRate[laneWidth] = {};
+};
+
+}
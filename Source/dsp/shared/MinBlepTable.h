@@ -0,0 +1,90 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "MinimumPhase.h"
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * MinBlepTable - band-limited step correction for sample-and-hold style outputs.
+ *
+ * A hold that changes value between two samples puts an ideal step on the
+ * host grid, and everything above the host Nyquist in that step folds back as
+ * inharmonic aliasing. Adding the residual of a minimum-phase band-limited
+ * step (minBLEP minus the ideal step) after each change removes it, at the
+ * cost of length multiply-adds per step and no latency.
+ *
+ * The table is built once, in the constructor: a Blackman-windowed sinc is
+ * made minimum phase through its real cepstrum, then integrated into a step.
+ */
+class MinBlepTable
+{
+public:
+    static constexpr int zeroCrossings = 8;
+    static constexpr int oversampling = 64;
+
+    // Output samples one step touches
+    static constexpr int length = 2 * zeroCrossings;
+
+    MinBlepTable()
+    {
+        build();
+    }
+
+    // Adds the correction for a step of height delta that happened fraction (0..1) of a
+    // sample before dest[0]; dest must have room for length samples
+    void addStep(float* dest, float fraction, float delta) const noexcept
+    {
+        const float start = juce::jlimit(0.0f, 0.999f, fraction) * static_cast<float>(oversampling);
+        const int index = static_cast<int>(start);
+        const float blend = start - static_cast<float>(index);
+
+        for (int i = 0; i < length; ++i)
+        {
+            const float* point = residual.data() + index + i * oversampling;
+            dest[i] += delta * (point[0] + blend * (point[1] - point[0]));
+        }
+    }
+
+private:
+    void build()
+    {
+        constexpr int numTaps = length * oversampling + 1;
+        constexpr int fftSize = 8192; // Zero padding keeps the cepstrum from wrapping
+        constexpr double cutoff = 0.9; // Fraction of the host Nyquist
+        const double pi = juce::MathConstants<double>::pi;
+
+        std::vector<double> sinc((size_t) numTaps);
+
+        // Windowed sinc at the oversampled rate
+        for (int i = 0; i < numTaps; ++i)
+        {
+            const double x = (i - (numTaps - 1) * 0.5) / oversampling;
+            const double value = x == 0.0 ? 1.0 : std::sin(pi * cutoff * x) / (pi * cutoff * x);
+            const double window = 0.42 - 0.5 * std::cos(2.0 * pi * i / (numTaps - 1))
+                                       + 0.08 * std::cos(4.0 * pi * i / (numTaps - 1));
+            sinc[(size_t) i] = value * window;
+        }
+
+        const auto impulse = MinimumPhase::fromTaps(sinc, fftSize, numTaps);
+
+        // Integrate the impulse into a step that settles at exactly 1, and keep what is left over
+        std::vector<double> step((size_t) numTaps);
+        double sum = 0.0;
+        for (int i = 0; i < numTaps; ++i)
+            step[(size_t) i] = (sum += impulse[(size_t) i]);
+
+        residual.resize((size_t) numTaps + 1);
+        for (int i = 0; i < numTaps; ++i)
+            residual[(size_t) i] = static_cast<float>(step[(size_t) i] / sum - 1.0);
+
+        residual[(size_t) numTaps - 1] = 0.0f;
+        residual[(size_t) numTaps] = 0.0f;
+    }
+
+    std::vector<float> residual; // length * oversampling + 1 points, plus one guard
+};
+
+}
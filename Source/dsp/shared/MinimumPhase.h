@@ -0,0 +1,94 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <complex>
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * MinimumPhase - the minimum-phase FIR with the same magnitude response as another.
+ *
+ * The real cepstrum of the filter is folded onto positive quefrencies and
+ * turned back into a spectrum, which moves the energy of the impulse as early
+ * as it can go without touching the magnitude. Zero padding to fftSize keeps
+ * the cepstrum from wrapping; zeros of the response are floored at -240 dB.
+ * Everything here allocates, so it belongs in table builds and prepare().
+ */
+struct MinimumPhase
+{
+    using Complex = std::complex<double>;
+
+    // The first numOutputTaps of the minimum-phase version of taps; fftSize must be a power of two
+    static std::vector<double> fromTaps(const std::vector<double>& taps, int fftSize, int numOutputTaps)
+    {
+        std::vector<Complex> spectrum((size_t) fftSize);
+        for (size_t i = 0; i < taps.size() && i < spectrum.size(); ++i)
+            spectrum[i] = taps[i];
+
+        transform(spectrum, false);
+        for (auto& bin : spectrum)
+            bin = std::log(juce::jmax(std::abs(bin), 1.0e-12));
+
+        transform(spectrum, true);
+        for (int i = 1; i < fftSize / 2; ++i)
+            spectrum[(size_t) i] *= 2.0;
+        for (int i = fftSize / 2 + 1; i < fftSize; ++i)
+            spectrum[(size_t) i] = 0.0;
+
+        transform(spectrum, false);
+        for (auto& bin : spectrum)
+            bin = std::exp(bin);
+
+        transform(spectrum, true);
+
+        std::vector<double> minimum((size_t) juce::jmin(numOutputTaps, fftSize));
+        for (size_t i = 0; i < minimum.size(); ++i)
+            minimum[i] = spectrum[i].real();
+
+        return minimum;
+    }
+
+    // In-place radix-2 FFT; the inverse is scaled by 1/N
+    static void transform(std::vector<Complex>& data, bool inverse)
+    {
+        const size_t n = data.size();
+
+        for (size_t i = 1, j = 0; i < n; ++i)
+        {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+
+            if (i < j)
+                std::swap(data[i], data[j]);
+        }
+
+        for (size_t size = 2; size <= n; size <<= 1)
+        {
+            const double angle = (inverse ? 2.0 : -2.0) * juce::MathConstants<double>::pi / static_cast<double>(size);
+            const Complex twiddleStep(std::cos(angle), std::sin(angle));
+
+            for (size_t start = 0; start < n; start += size)
+            {
+                Complex twiddle(1.0, 0.0);
+                for (size_t k = 0; k < size / 2; ++k)
+                {
+                    const Complex even = data[start + k];
+                    const Complex odd = data[start + k + size / 2] * twiddle;
+                    data[start + k] = even + odd;
+                    data[start + k + size / 2] = even - odd;
+                    twiddle *= twiddleStep;
+                }
+            }
+        }
+
+        if (inverse)
+            for (auto& value : data)
+                value /= static_cast<double>(n);
+    }
+};
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../core/ScratchArena.h"
+#include "HalfbandOversampler.h"
+
+namespace ReallyCheap
+{
+
+/**
+ * OversampledDomain - one upsample, a run of modules at the higher rate, one downsample.
+ *
+ * The modules inside are prepared at getFactor() times the host rate and
+ * block size, and see the oversampler's own storage, so several nonlinear
+ * stages share a single pair of halfband filters instead of each paying for
+ * their own. The filters are linear phase: alignDryPath() delays the unprocessed
+ * signal by a whole number of samples so the mix lines up, and only a linear-
+ * phase round trip is exactly that delay at every frequency. A minimum-phase
+ * one would be shorter but would cancel against the dry path towards the top
+ * of the band.
+ *
+ * While nothing inside is switched on the resampling is skipped and adds no
+ * latency. Its filters and dry delay restart from silence when it comes back.
+ */
+class OversampledDomain
+{
+public:
+    // Builds the filters and the dry delay; factor is 1, 2 or 4. Call off the audio thread.
+    void prepare(int numChannels, int maxBlockSize, int factor)
+    {
+        int stages = 0;
+        while ((2 << stages) <= factor && stages < HalfbandOversampler::maxStages)
+            ++stages;
+
+        oversampler.prepare(numChannels, maxBlockSize, stages, HalfbandOversampler::Phase::linear);
+        dryDelay.setSize(numChannels, maxBlockSize + oversampler.getLatencySamples() + 1);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        oversampler.reset();
+        dryDelay.clear();
+        dryWritePos = 0;
+        wasActive = false;
+    }
+
+    int getFactor() const noexcept { return oversampler.getFactor(); }
+
+    // Host samples added while active
+    int getLatencySamples() const noexcept { return oversampler.getFactor() > 1 ? oversampler.getLatencySamples() : 0; }
+
+    // Runs processOversampled(juce::AudioBuffer<float>&) on buffer at the higher rate. At 1x, or
+    // while isActive is false because every module inside is off, it gets buffer as it is, so the
+    // modules still see their parameters change.
+    template <typename Function>
+    void process(juce::AudioBuffer<float>& buffer, bool isActive, Function&& processOversampled) noexcept
+    {
+        if (! isActive || getFactor() == 1)
+        {
+            wasActive = false;
+            processOversampled(buffer);
+            return;
+        }
+
+        // Whatever the filters held is from before the gap
+        if (! wasActive)
+        {
+            oversampler.reset();
+            dryDelay.clear();
+            dryWritePos = 0;
+            wasActive = true;
+        }
+
+        juce::dsp::AudioBlock<float> block(buffer);
+        auto oversampledBlock = oversampler.processSamplesUp(block);
+
+        // Work on the oversampler's own storage rather than copying it out and back
+        const int oversampledChannels = juce::jmin(static_cast<int>(oversampledBlock.getNumChannels()), ScratchArena::maxChannels);
+        float* oversampledChannelPointers[ScratchArena::maxChannels] = {};
+        for (int ch = 0; ch < oversampledChannels; ++ch)
+            oversampledChannelPointers[ch] = oversampledBlock.getChannelPointer(static_cast<size_t>(ch));
+
+        juce::AudioBuffer<float> oversampledView(oversampledChannelPointers, oversampledChannels,
+                                                 static_cast<int>(oversampledBlock.getNumSamples()));
+        processOversampled(oversampledView);
+
+        oversampler.processSamplesDown(block);
+    }
+
+    // Delays dryBuffer by getLatencySamples() while the domain is active
+    void alignDryPath(juce::AudioBuffer<float>& dryBuffer) noexcept
+    {
+        const int latency = getLatencySamples();
+        const int delaySize = dryDelay.getNumSamples();
+        if (! wasActive || latency <= 0 || delaySize <= latency)
+            return;
+
+        const int numSamples = dryBuffer.getNumSamples();
+        const int channels = juce::jmin(dryBuffer.getNumChannels(), dryDelay.getNumChannels());
+        int writePos = dryWritePos;
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            auto* data = dryBuffer.getWritePointer(ch);
+            auto* delay = dryDelay.getWritePointer(ch);
+
+            writePos = dryWritePos;
+            int readPos = writePos - latency;
+            if (readPos < 0)
+                readPos += delaySize;
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                delay[writePos] = data[i];
+                data[i] = delay[readPos];
+
+                if (++writePos == delaySize) writePos = 0;
+                if (++readPos == delaySize) readPos = 0;
+            }
+        }
+
+        dryWritePos = writePos;
+    }
+
+private:
+    HalfbandOversampler oversampler;
+    juce::AudioBuffer<float> dryDelay;
+    int dryWritePos = 0;
+    bool wasActive = false;
+};
+
+}
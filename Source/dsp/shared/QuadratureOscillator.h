@@ -0,0 +1,56 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+
+namespace ReallyCheap
+{
+
+/**
+ * QuadratureOscillator - sine and cosine from a rotating phasor.
+ *
+ * Each step turns the phasor by a fixed rotation, four multiplies and two
+ * adds, instead of calling sin. Rounding slowly pulls a free-running phasor
+ * off the unit circle, so the owner re-anchors it with setPhase() from an
+ * exact phase every block and only steps it a block's worth at a time.
+ */
+class QuadratureOscillator
+{
+public:
+    struct Rotation
+    {
+        float cosine = 1.0f;
+        float sine = 0.0f;
+    };
+
+    // The turn for one step of cyclesPerStep cycles
+    static Rotation makeRotation(double cyclesPerStep) noexcept
+    {
+        const double angle = juce::MathConstants<double>::twoPi * cyclesPerStep;
+        return { static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)) };
+    }
+
+    // Phase in cycles, any range
+    void setPhase(double phase) noexcept
+    {
+        const double angle = juce::MathConstants<double>::twoPi * (phase - std::floor(phase));
+        real = static_cast<float>(std::cos(angle));
+        imaginary = static_cast<float>(std::sin(angle));
+    }
+
+    void advance(const Rotation& rotation) noexcept
+    {
+        const float nextReal = real * rotation.cosine - imaginary * rotation.sine;
+        imaginary = real * rotation.sine + imaginary * rotation.cosine;
+        real = nextReal;
+    }
+
+    float getSine() const noexcept { return imaginary; }
+    float getCosine() const noexcept { return real; }
+
+private:
+    float real = 1.0f;
+    float imaginary = 0.0f;
+};
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <vector>
+
+namespace ReallyCheap
+{
+
+/**
+ * SincTable - Kaiser-windowed sinc kernels for fractional delay reads.
+ *
+ * One row per phase between two samples, numPhases of them plus the end
+ * point. A row holds the numTaps coefficients for its phase, followed by
+ * the step to the next row's, so a read can move linearly between
+ * neighbouring phases instead of snapping to the nearest one. Rows are
+ * scaled to unity gain at DC.
+ *
+ * The kernel is a full-band sinc, so whole-sample delays read back exactly,
+ * with beta 9: the error stays near -88 dB up to 0.3 of the sample rate and
+ * rises towards Nyquist, where the delay's own anti-aliasing filter has
+ * already taken the signal down.
+ *
+ * There is one shared table, built on the first call to get(); call it
+ * during prepare so that never happens on the audio thread.
+ */
+class SincTable
+{
+public:
+    static constexpr int numTaps = 16;
+    static constexpr int numPhases = 256;
+    static constexpr int rowSize = 2 * numTaps;
+
+    static const SincTable& get()
+    {
+        static const SincTable table;
+        return table;
+    }
+
+    // Row for phase 0..numPhases, where phase / numPhases is how far the read point lies past
+    // tap numTaps / 2 - 1, towards tap numTaps / 2
+    const float* getRow(int phase) const noexcept { return rows.data() + phase * rowSize; }
+
+private:
+    SincTable()
+    {
+        constexpr double beta = 9.0;
+        constexpr int halfTaps = numTaps / 2;
+        const double windowScale = 1.0 / besselI0(beta);
+
+        std::vector<double> kernel(static_cast<size_t>((numPhases + 2) * numTaps));
+
+        // One row past the end point too, so the end point has a step like the others
+        for (int phase = 0; phase <= numPhases + 1; ++phase)
+        {
+            const double position = static_cast<double>(phase) / numPhases;
+            double* row = kernel.data() + phase * numTaps;
+            double sum = 0.0;
+
+            for (int tap = 0; tap < numTaps; ++tap)
+            {
+                const double distance = static_cast<double>(halfTaps - 1 - tap) + position;
+                const double edge = distance / halfTaps;
+                double value = 0.0;
+
+                if (std::abs(edge) < 1.0)
+                {
+                    const double sinc = distance == 0.0 ? 1.0 : std::sin(juce::MathConstants<double>::pi * distance)
+                                                                    / (juce::MathConstants<double>::pi * distance);
+                    value = sinc * besselI0(beta * std::sqrt(1.0 - edge * edge)) * windowScale;
+                }
+
+                row[tap] = value;
+                sum += value;
+            }
+
+            for (int tap = 0; tap < numTaps; ++tap)
+                row[tap] /= sum;
+        }
+
+        rows.resize(static_cast<size_t>((numPhases + 1) * rowSize));
+
+        for (int phase = 0; phase <= numPhases; ++phase)
+        {
+            const double* current = kernel.data() + phase * numTaps;
+            const double* next = current + numTaps;
+            float* row = rows.data() + phase * rowSize;
+
+            for (int tap = 0; tap < numTaps; ++tap)
+            {
+                row[tap] = static_cast<float>(current[tap]);
+                row[numTaps + tap] = static_cast<float>(next[tap] - current[tap]);
+            }
+        }
+    }
+
+    // Zeroth-order modified Bessel function of the first kind, by its power series
+    static double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+
+        for (int k = 1; k < 50 && term > 1.0e-12 * sum; ++k)
+        {
+            const double half = x / (2.0 * k);
+            term *= half * half;
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    std::vector<float> rows;
+};
+
+}
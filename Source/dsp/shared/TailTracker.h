@@ -0,0 +1,74 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ReallyCheap
+{
+
+/**
+ * TailTracker - decides when a module can stop computing.
+ *
+ * A module reports each block as quiet or not; once it has seen enough
+ * consecutive quiet samples for its internal state to have died away, the
+ * tracker goes to sleep. The first non-quiet block wakes it again. What counts
+ * as "quiet" and how long the tail is are up to the module.
+ */
+class TailTracker
+{
+public:
+    // About -100 dBFS: below 24-bit dither, so dropping it is inaudible
+    static constexpr float silenceThreshold = 1.0e-5f;
+
+    static bool isSilent(const juce::AudioBuffer<float>& buffer,
+                         float threshold = silenceThreshold) noexcept
+    {
+        if (buffer.hasBeenCleared())
+            return true;
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            if (buffer.getMagnitude(ch, 0, buffer.getNumSamples()) >= threshold)
+                return false;
+
+        return true;
+    }
+
+    // Number of consecutive quiet samples needed before sleeping
+    void prepare(int tailSamples) noexcept
+    {
+        requiredQuietSamples = juce::jmax(0, tailSamples);
+        wake();
+    }
+
+    void wake() noexcept
+    {
+        quietSamples = 0;
+        sleeping = false;
+    }
+
+    // Returns true only for the block that puts the tracker to sleep, so the
+    // caller can clear whatever residue its state still holds at that point
+    bool addBlock(bool blockWasQuiet, int numSamples) noexcept
+    {
+        if (! blockWasQuiet)
+        {
+            wake();
+            return false;
+        }
+
+        if (sleeping)
+            return false;
+
+        quietSamples += numSamples;
+        sleeping = quietSamples >= requiredQuietSamples;
+        return sleeping;
+    }
+
+    bool isSleeping() const noexcept { return sleeping; }
+
+private:
+    juce::int64 quietSamples = 0;
+    juce::int64 requiredQuietSamples = 0;
+    bool sleeping = false;
+};
+
+}
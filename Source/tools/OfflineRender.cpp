@@ -0,0 +1,295 @@
+#include <JuceHeader.h>
+#include <iostream>
+#include "../core/PluginProcessor.h"
+
+/**
+ * ReallyCheap-Render - headless offline renderer.
+ *
+ * Runs ReallyCheapTwentyAudioProcessor over WAV files without a host, an
+ * editor or a running message loop. Audio is streamed through processBlock in
+ * fixed-size chunks, so file length is bounded only by disk space. The output
+ * lines up with the input, with the processing latency taken out, and runs
+ * on past its end for as long as the effects' tail.
+ *
+ * Usage:
+ *   ReallyCheap-Render --preset <file.rc20preset | factory name>
+ *                      [--block <samples>] [--bits <16|24|32>] [--seed <n>]
+ *                      [--output <file.wav | directory>] input.wav [input2.wav ...]
+ */
+
+namespace
+{
+
+struct RenderOptions
+{
+    juce::String preset;
+    juce::File output;
+    int blockSize = 512;
+    int bitDepth = 0; // 0 = follow the input file
+    bool useSeed = false; // Otherwise hiss, jitter and dither differ on every run
+    juce::uint64 seed = 0;
+    juce::Array<juce::File> inputs;
+};
+
+void printUsage()
+{
+    std::cout << "Usage: ReallyCheap-Render --preset <file.rc20preset | factory name>\n"
+              << "                          [--block <samples>] [--bits <16|24|32>] [--seed <n>]\n"
+              << "                          [--output <file.wav | directory>] input.wav [input2.wav ...]\n";
+}
+
+bool parseArguments(int argc, char* argv[], RenderOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if ((arg == "--preset" || arg == "-p") && hasValue)
+            options.preset = argv[++i];
+        else if ((arg == "--block" || arg == "-b") && hasValue)
+            options.blockSize = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--bits" && hasValue)
+            options.bitDepth = juce::String(argv[++i]).getIntValue();
+        else if (arg == "--seed" && hasValue)
+        {
+            options.useSeed = true;
+            options.seed = static_cast<juce::uint64>(juce::String(argv[++i]).getLargeIntValue());
+        }
+        else if ((arg == "--output" || arg == "-o") && hasValue)
+            options.output = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg == "--help" || arg == "-h")
+            return false;
+        else if (arg.startsWith("-"))
+        {
+            std::cerr << "Unknown or incomplete option: " << arg << "\n";
+            return false;
+        }
+        else
+            options.inputs.add(juce::File::getCurrentWorkingDirectory().getChildFile(arg));
+    }
+
+    if (options.inputs.isEmpty())
+    {
+        std::cerr << "No input files given\n";
+        return false;
+    }
+
+    if (options.blockSize < 1 || options.blockSize > 65536)
+    {
+        std::cerr << "Block size must be between 1 and 65536 samples\n";
+        return false;
+    }
+
+    if (options.bitDepth != 0 && options.bitDepth != 16 && options.bitDepth != 24 && options.bitDepth != 32)
+    {
+        std::cerr << "Bit depth must be 16, 24 or 32\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool loadPreset(ReallyCheapTwentyAudioProcessor& processor, const juce::String& preset)
+{
+    if (preset.isEmpty())
+        return true; // Processor constructor already applied the default factory preset
+
+    const auto presetFile = juce::File::getCurrentWorkingDirectory().getChildFile(preset);
+
+    if (presetFile.existsAsFile())
+        return processor.getPresetManager().loadPreset(presetFile);
+
+    return processor.getPresetManager().loadFactoryPreset(preset);
+}
+
+juce::File getOutputFileFor(const juce::File& input, const RenderOptions& options)
+{
+    const auto renderedName = input.getFileNameWithoutExtension() + "_rc20.wav";
+
+    if (options.output == juce::File())
+        return input.getSiblingFile(renderedName);
+
+    if (options.output.isDirectory() || options.inputs.size() > 1)
+        return options.output.getChildFile(renderedName);
+
+    return options.output;
+}
+
+bool renderFile(ReallyCheapTwentyAudioProcessor& processor,
+                juce::AudioFormatManager& formatManager,
+                const juce::File& input,
+                const juce::File& output,
+                const RenderOptions& options)
+{
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(input));
+
+    if (reader == nullptr)
+    {
+        std::cerr << "Could not open " << input.getFullPathName() << "\n";
+        return false;
+    }
+
+    const int numChannels = static_cast<int>(reader->numChannels);
+    const double sampleRate = reader->sampleRate;
+    const juce::int64 lengthInSamples = reader->lengthInSamples;
+
+    // Match the processor's buses to the file instead of forcing stereo
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+    layout.outputBuses.add(juce::AudioChannelSet::canonicalChannelSet(numChannels));
+
+    if (! processor.setBusesLayout(layout))
+    {
+        std::cerr << input.getFileName() << ": " << numChannels << "-channel audio is not supported\n";
+        return false;
+    }
+
+    int bitDepth = options.bitDepth;
+    if (bitDepth == 0)
+        bitDepth = juce::jlimit(16, 32, static_cast<int>(reader->bitsPerSample));
+    if (bitDepth != 16 && bitDepth != 24 && bitDepth != 32)
+        bitDepth = 24;
+
+    output.getParentDirectory().createDirectory();
+    output.deleteFile();
+
+    auto outputStream = std::make_unique<juce::FileOutputStream>(output);
+    if (! outputStream->openedOk())
+    {
+        std::cerr << "Could not create " << output.getFullPathName() << "\n";
+        return false;
+    }
+
+    juce::WavAudioFormat wavFormat;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wavFormat.createWriterFor(outputStream.get(), sampleRate,
+                                                                              static_cast<unsigned int>(numChannels),
+                                                                              bitDepth, {}, 0));
+    if (writer == nullptr)
+    {
+        std::cerr << "Could not create a WAV writer for " << output.getFullPathName() << "\n";
+        return false;
+    }
+
+    outputStream.release(); // Now owned by the writer
+
+    // Reseeded per file, so each output depends only on its own input
+    if (options.useSeed)
+        processor.setRandomSeed(options.seed);
+
+    processor.setNonRealtime(true);
+    processor.setRateAndBufferSizeDetails(sampleRate, options.blockSize);
+    processor.prepareToPlay(sampleRate, options.blockSize);
+
+    juce::AudioBuffer<float> buffer(numChannels, options.blockSize);
+    juce::MidiBuffer midi;
+
+    double processingSeconds = 0.0;
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    // Silence is fed past the end of the input until the latency and the tail have come out,
+    // and the first latency samples of output are dropped. Both depend on the preset, so they
+    // are known once the first block has run.
+    juce::int64 inputLength = lengthInSamples;
+    juce::int64 latencyToSkip = -1;
+    juce::int64 tailSamples = 0;
+
+    for (juce::int64 position = 0; position < inputLength;)
+    {
+        const int numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(options.blockSize),
+                                                           inputLength - position));
+        const int fromFile = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0),
+                                                           static_cast<juce::int64>(numSamples),
+                                                           lengthInSamples - position));
+
+        // The final chunk is usually short; hand the processor a view of exactly that many samples
+        juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+        block.clear();
+
+        if (fromFile > 0 && ! reader->read(block.getArrayOfWritePointers(), numChannels, position, fromFile))
+        {
+            std::cerr << "Read error in " << input.getFullPathName() << " at sample " << position << "\n";
+            processor.releaseResources();
+            return false;
+        }
+
+        const auto blockStart = juce::Time::getHighResolutionTicks();
+        processor.processBlock(block, midi);
+        processingSeconds += juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - blockStart);
+
+        if (latencyToSkip < 0)
+        {
+            latencyToSkip = processor.getProcessingLatencySamples();
+            tailSamples = static_cast<juce::int64>(std::ceil(processor.getTailLengthSeconds() * sampleRate));
+            inputLength = lengthInSamples + latencyToSkip + tailSamples;
+        }
+
+        const int skipped = static_cast<int>(juce::jmin(latencyToSkip, static_cast<juce::int64>(numSamples)));
+        latencyToSkip -= skipped;
+
+        if (! writer->writeFromAudioSampleBuffer(block, skipped, numSamples - skipped))
+        {
+            std::cerr << "Write error in " << output.getFullPathName() << "\n";
+            processor.releaseResources();
+            return false;
+        }
+
+        position += numSamples;
+    }
+
+    writer.reset(); // Flush and close the file before reporting
+    processor.releaseResources();
+
+    const double totalSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+    const double audioSeconds = static_cast<double>(lengthInSamples) / sampleRate;
+
+    std::cout << input.getFileName() << " -> " << output.getFullPathName() << "\n"
+              << "    " << juce::String(audioSeconds, 2) << " s of audio plus "
+              << juce::String(static_cast<double>(tailSamples) / sampleRate, 2) << " s of tail, " << numChannels << " ch @ "
+              << juce::String(sampleRate, 0) << " Hz, block " << options.blockSize << "\n"
+              << "    realtime factor " << juce::String(audioSeconds / juce::jmax(processingSeconds, 1.0e-9), 1)
+              << "x (processing), " << juce::String(audioSeconds / juce::jmax(totalSeconds, 1.0e-9), 1)
+              << "x (including file I/O)\n";
+
+    if (ReallyCheap::AllocationCounter::isEnabled())
+        std::cout << "    heap allocations inside processBlock so far: "
+                  << processor.getAudioThreadAllocationCount() << "\n";
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    RenderOptions options;
+    if (! parseArguments(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    // The processor and asset managers expect a message manager to exist on this thread.
+    // Nothing here opens a window or runs the message loop, so no display is needed.
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    ReallyCheapTwentyAudioProcessor processor;
+
+    if (! loadPreset(processor, options.preset))
+    {
+        std::cerr << "Could not load preset '" << options.preset << "'\n";
+        return 1;
+    }
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    int failures = 0;
+    for (const auto& input : options.inputs)
+    {
+        if (! renderFile(processor, formatManager, input, getOutputFileFor(input, options), options))
+            ++failures;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -52,6 +52,13 @@ ReallyCheap::DigitalPanel::DigitalPanel(juce::AudioProcessorValueTreeState& apvt
     aaLabel.setText("", juce::dontSendNotification);
     addAndMakeVisible(aaLabel);
     
+    // Hold mode combo
+    holdCombo.addItemList(juce::StringArray{"naive", "band-limited"}, 1);
+    addAndMakeVisible(holdCombo);
+    holdLabel.setText("Hold", juce::dontSendNotification);
+    holdLabel.setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(holdLabel);
+    
     // Create attachments
     onAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
         apvts, ParameterIDs::digitalOn, onButton);
@@ -63,6 +70,8 @@ ReallyCheap::DigitalPanel::DigitalPanel(juce::AudioProcessorValueTreeState& apvt
         apvts, ParameterIDs::digitalJitter, jitterSlider);
     aaAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
         apvts, ParameterIDs::digitalAA, aaButton);
+    holdAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        apvts, ParameterIDs::digitalSRMode, holdCombo);
 }
 
 ReallyCheap::DigitalPanel::~DigitalPanel()
@@ -124,9 +133,16 @@ void ReallyCheap::DigitalPanel::resized()
     
     area.removeFromTop(10);
     
-    // Third row: Jitter slider (centered)
+    // Third row: Jitter slider and Hold mode
     auto row3 = area.removeFromTop(80);
-    auto jitterArea = row3.withSizeKeepingCentre(sliderWidth, 80);
+    
+    auto jitterArea = row3.removeFromLeft(sliderWidth);
     jitterSlider.setBounds(jitterArea.removeFromTop(60));
     jitterLabel.setBounds(jitterArea);
+    
+    row3.removeFromLeft(10);
+    
+    auto holdArea = row3.removeFromLeft(sliderWidth).withSizeKeepingCentre(sliderWidth, 50);
+    holdCombo.setBounds(holdArea.removeFromTop(30));
+    holdLabel.setBounds(holdArea);
 }
\ No newline at end of file
@@ -37,12 +37,16 @@ private:
     juce::ToggleButton aaButton;
     juce::Label aaLabel;
     
+    juce::ComboBox holdCombo;
+    juce::Label holdLabel;
+    
     // Attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> onAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> bitsAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> srAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> jitterAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> aaAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> holdAttachment;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DigitalPanel)
 };
@@ -22,6 +22,13 @@ ReallyCheap::DistortPanel::DistortPanel(juce::AudioProcessorValueTreeState& apvt
     typeLabel.setJustificationType(juce::Justification::centred);
     addAndMakeVisible(typeLabel);
     
+    // Oversampling combo; 1x and 2x antialias the shaper itself
+    oversamplingCombo.addItemList(juce::StringArray{"1x", "2x", "4x", "8x"}, 1);
+    addAndMakeVisible(oversamplingCombo);
+    oversamplingLabel.setText("Oversample", juce::dontSendNotification);
+    oversamplingLabel.setJustificationType(juce::Justification::centred);
+    addAndMakeVisible(oversamplingLabel);
+    
     // Drive slider
     driveSlider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
     driveSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 50, 18);
@@ -47,6 +54,8 @@ ReallyCheap::DistortPanel::DistortPanel(juce::AudioProcessorValueTreeState& apvt
         apvts, "distortOn", onButton);
     typeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         apvts, "distortType", typeCombo);
+    oversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        apvts, ParameterIDs::distortOversampling, oversamplingCombo);
     driveAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         apvts, "distortDrive", driveSlider);
     toneAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
@@ -80,9 +89,9 @@ void ReallyCheap::DistortPanel::resized()
     titleLabel.setBounds(area.removeFromTop(25));
     area.removeFromTop(10);
     
-    // First row: ON button and Type combo
+    // First row: ON button, Type and Oversample combos
     auto row1 = area.removeFromTop(60);
-    auto buttonWidth = row1.getWidth() / 2 - 5;
+    auto buttonWidth = (row1.getWidth() - 20) / 3;
     
     auto onArea = row1.removeFromLeft(buttonWidth);
     onButton.setBounds(onArea.removeFromTop(30));
@@ -94,6 +103,12 @@ void ReallyCheap::DistortPanel::resized()
     typeCombo.setBounds(typeArea.removeFromTop(30));
     typeLabel.setBounds(typeArea);
     
+    row1.removeFromLeft(10);
+    
+    auto oversamplingArea = row1.removeFromLeft(buttonWidth);
+    oversamplingCombo.setBounds(oversamplingArea.removeFromTop(30));
+    oversamplingLabel.setBounds(oversamplingArea);
+    
     area.removeFromTop(10);
     
     // Second row: Drive and Tone sliders
@@ -22,11 +22,13 @@ private:
     // Basic distortion controls
     juce::ToggleButton onButton;
     juce::ComboBox typeCombo;
+    juce::ComboBox oversamplingCombo;
     juce::Slider driveSlider;
     juce::Slider toneSlider;
     
     juce::Label onLabel;
     juce::Label typeLabel;
+    juce::Label oversamplingLabel;
     juce::Label driveLabel;
     juce::Label toneLabel;
     juce::Label titleLabel;
@@ -34,6 +36,7 @@ private:
     // Attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> onAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> typeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> driveAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> toneAttachment;
     
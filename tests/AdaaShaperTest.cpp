@@ -0,0 +1,105 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/Distort.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+using DistortType = Distort::DistortType;
+
+/**
+ * AdaaShaperTest - checks that antiderivative antialiasing does what it is for.
+ * Each of Distort's shapers is driven hard with a 4110 Hz sine at 48 kHz, whose
+ * harmonics above 24 kHz fold back between its own lines. First-order ADAA must
+ * leave less of that aliasing than shaping sample by sample, and second-order
+ * less again.
+ */
+class AdaaShaperTest : public juce::UnitTest
+{
+public:
+    AdaaShaperTest() : juce::UnitTest("ADAA shaper aliasing", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("Tape");
+        expectLessAliasing(Distort::shape<DistortType::Tape>);
+
+        beginTest("Diode");
+        expectLessAliasing(Distort::shape<DistortType::Diode>);
+
+        beginTest("Fold");
+        expectLessAliasing(Distort::shape<DistortType::Fold>);
+    }
+
+private:
+    // 411 cycles in 4800 samples: every harmonic and every alias lands on a 10 Hz bin
+    static constexpr int analysisSamples = 4800;
+    static constexpr int cycles = 411;
+    static constexpr double drive = 4.0;
+    static constexpr double margin = 5.0;
+
+    void expectLessAliasing(AdaaShaper::Shape shape)
+    {
+        AdaaShaper shaper;
+        shaper.build(shape);
+
+        AdaaShaper::State firstOrderState, secondOrderState;
+        std::vector<float> plain((size_t) analysisSamples), firstOrder(plain.size()), secondOrder(plain.size());
+
+        // One window to settle the ADAA states, then the analysis window
+        for (int n = -analysisSamples; n < analysisSamples; ++n)
+        {
+            const double phase = juce::MathConstants<double>::twoPi * cycles * n / analysisSamples;
+            const float x = static_cast<float>(drive * std::sin(phase));
+            const float first = shaper.processFirstOrder(firstOrderState, x);
+            const float second = shaper.processSecondOrder(secondOrderState, x);
+
+            if (n >= 0)
+            {
+                plain[(size_t) n] = shaper.processPlain(x);
+                firstOrder[(size_t) n] = first;
+                secondOrder[(size_t) n] = second;
+            }
+        }
+
+        const double plainDb = aliasingDb(plain);
+        const double firstOrderDb = aliasingDb(firstOrder);
+        const double secondOrderDb = aliasingDb(secondOrder);
+
+        expectLessThan(firstOrderDb, plainDb - margin);
+        expectLessThan(secondOrderDb, firstOrderDb - margin);
+    }
+
+    // Power away from the harmonics, relative to the power on them, in dB
+    static double aliasingDb(const std::vector<float>& window)
+    {
+        // The DFT only ever needs the analysis window's own roots of unity
+        std::vector<double> cosTable((size_t) analysisSamples), sinTable((size_t) analysisSamples);
+        for (int n = 0; n < analysisSamples; ++n)
+        {
+            cosTable[(size_t) n] = std::cos(juce::MathConstants<double>::twoPi * n / analysisSamples);
+            sinTable[(size_t) n] = std::sin(juce::MathConstants<double>::twoPi * n / analysisSamples);
+        }
+
+        double harmonics = 0.0, aliases = 0.0;
+
+        for (int bin = 1; bin < analysisSamples / 2; ++bin)
+        {
+            double re = 0.0, im = 0.0;
+            for (int n = 0; n < analysisSamples; ++n)
+            {
+                const auto index = (size_t) ((bin * n) % analysisSamples);
+                re += window[(size_t) n] * cosTable[index];
+                im -= window[(size_t) n] * sinTable[index];
+            }
+
+            (bin % cycles == 0 ? harmonics : aliases) += re * re + im * im;
+        }
+
+        return 10.0 * std::log10(aliases / harmonics);
+    }
+};
+
+AdaaShaperTest adaaShaperTest;
+
+} // namespace
@@ -0,0 +1,133 @@
+#include <JuceHeader.h>
+#include "../Source/core/BlockRandom.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * BlockRandomTest - checks that a seed reproduces the same noise whatever the
+ * mix of calls, that different seeds and different streams do not repeat each
+ * other, and that each fill has the range, mean and variance it promises.
+ */
+class BlockRandomTest : public juce::UnitTest
+{
+public:
+    BlockRandomTest() : juce::UnitTest("Block random", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("a seed reproduces");
+        {
+            BlockRandom first, second;
+            first.setSeed(0x5eed);
+            second.setSeed(0x5eed);
+
+            // Blocks of every size around the stream count, and single draws in between
+            bool same = true;
+            std::vector<float> a(100), b(100);
+            for (int size = 1; size < 100; size += 7)
+            {
+                first.fillUniform(a.data(), size);
+                second.fillUniform(b.data(), size);
+                same = same && std::equal(a.begin(), a.begin() + size, b.begin());
+
+                first.fillTPDF(a.data(), size);
+                second.fillTPDF(b.data(), size);
+                same = same && std::equal(a.begin(), a.begin() + size, b.begin());
+
+                first.fillGaussian(a.data(), size);
+                second.fillGaussian(b.data(), size);
+                same = same && std::equal(a.begin(), a.begin() + size, b.begin());
+
+                same = same && first.nextFloat() == second.nextFloat();
+            }
+
+            expect(same);
+
+            // Seeding again starts the sequence over
+            first.setSeed(0x5eed);
+            second.setSeed(0x5eed);
+            first.fillUniform(a.data(), 64);
+            second.fillUniform(b.data(), 64);
+            expect(std::equal(a.begin(), a.begin() + 64, b.begin()));
+        }
+
+        beginTest("seeds and streams differ");
+        {
+            BlockRandom first, second;
+            first.setSeed(1);
+            second.setSeed(2);
+
+            std::vector<float> a(numSamples), b(numSamples);
+            first.fillUniform(a.data(), numSamples);
+            second.fillUniform(b.data(), numSamples);
+
+            int matches = 0;
+            for (int i = 0; i < numSamples; ++i)
+                matches += a[(size_t) i] == b[(size_t) i] ? 1 : 0;
+
+            expectLessThan(matches, 10);
+
+            // Neighbouring samples come from different streams and must not move together
+            expectLessThan(std::abs(correlation(a.data(), a.data() + 1, numSamples - 1)), 0.02);
+            expectLessThan(std::abs(correlation(a.data(), a.data() + BlockRandom::numStreams,
+                                                numSamples - BlockRandom::numStreams)), 0.02);
+        }
+
+        beginTest("uniform, TPDF and Gaussian statistics");
+        {
+            BlockRandom random;
+            random.setSeed(0x1234);
+            std::vector<float> data(numSamples);
+
+            random.fillUniform(data.data(), numSamples);
+            expectStatistics(data, -1.0f, 1.0f, 1.0 / 3.0);
+
+            random.fillTPDF(data.data(), numSamples);
+            expectStatistics(data, -1.0f, 1.0f, 1.0 / 6.0);
+
+            random.fillGaussian(data.data(), numSamples);
+            expectStatistics(data, -3.47f, 3.47f, 1.0);
+        }
+    }
+
+private:
+    static constexpr int numSamples = 1 << 16;
+
+    void expectStatistics(const std::vector<float>& data, float lowest, float highest, double variance)
+    {
+        double sum = 0.0, sumOfSquares = 0.0;
+        bool inRange = true;
+
+        for (auto x : data)
+        {
+            inRange = inRange && x >= lowest && x < highest;
+            sum += x;
+            sumOfSquares += (double) x * x;
+        }
+
+        const double mean = sum / (double) data.size();
+        expect(inRange);
+        expectLessThan(std::abs(mean), 0.01);
+        expectLessThan(std::abs(sumOfSquares / (double) data.size() - mean * mean - variance), 0.02 * variance);
+    }
+
+    static double correlation(const float* x, const float* y, int count)
+    {
+        double xy = 0.0, xx = 0.0, yy = 0.0;
+        for (int i = 0; i < count; ++i)
+        {
+            xy += (double) x[i] * y[i];
+            xx += (double) x[i] * x[i];
+            yy += (double) y[i] * y[i];
+        }
+
+        return xy / std::sqrt(xx * yy);
+    }
+};
+
+BlockRandomTest blockRandomTest;
+
+} // namespace
@@ -0,0 +1,127 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/shared/DelayLine.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * DelayLineTest - checks that every read lands on the sample it names, through
+ * many laps of the buffer, and that Hermite reads between samples follow a
+ * smooth signal.
+ */
+class DelayLineTest : public juce::UnitTest
+{
+public:
+    DelayLineTest() : juce::UnitTest("Delay line", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("push and read");
+        {
+            DelayLine<float> line;
+            line.prepare(maxDelay);
+
+            bool allExact = true;
+            for (int n = 0; n < numSamples; ++n)
+            {
+                line.push(ramp(n));
+
+                for (int delay = 1; delay <= juce::jmin(n + 1, maxDelay); delay += 7)
+                    allExact = allExact && line.read(delay) == ramp(n + 1 - delay);
+            }
+
+            expect(allExact);
+        }
+
+        beginTest("block reads at whole delays");
+        {
+            DelayLine<float> line;
+            line.prepare(maxDelay, blockSize);
+
+            float input[blockSize], delays[blockSize], linear[blockSize], blockLinear[blockSize];
+            float hermite[blockSize], sinc[blockSize];
+            bool allExact = true;
+            double worstError = 0.0;
+
+            for (int start = 0, block = 0; start + blockSize <= numSamples; start += blockSize, ++block)
+            {
+                const int wholeDelay = SincTable::numTaps / 2 + (block * 13) % (maxDelay - SincTable::numTaps);
+
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    input[i] = ramp(start + i);
+                    delays[i] = static_cast<float>(wholeDelay);
+                }
+
+                line.write(input, blockSize);
+                line.readLinear(static_cast<float>(wholeDelay), linear, blockSize);
+                line.readLinear(delays, blockLinear, blockSize);
+                line.readHermite(delays, hermite, blockSize);
+                line.readSinc(delays, sinc, blockSize);
+
+                // Linear reads are exact at whole delays; the others to rounding
+                if (start >= maxDelay)
+                    for (int i = 0; i < blockSize; ++i)
+                    {
+                        const float expected = ramp(start + i - wholeDelay);
+                        allExact = allExact && linear[i] == expected && blockLinear[i] == expected;
+                        worstError = juce::jmax(worstError, (double) std::abs(hermite[i] - expected));
+                        worstError = juce::jmax(worstError, (double) std::abs(sinc[i] - expected));
+                    }
+            }
+
+            expect(allExact);
+            expectLessThan(worstError, 2.0e-3);
+        }
+
+        // A tenth of the sample rate, moving through every fraction of a sample
+        const std::tuple<DelayInterpolation, const char*, double> tiers[] { { DelayInterpolation::linear, "linear", 0.06 },
+                                                                            { DelayInterpolation::hermite, "hermite", 0.01 },
+                                                                            { DelayInterpolation::sinc, "sinc", 1.0e-4 } };
+
+        for (const auto& [interpolation, tierName, bound] : tiers)
+        {
+            beginTest(juce::String("fractional ") + tierName + " reads");
+
+            DelayLine<float> line;
+            line.prepare(maxDelay, blockSize);
+
+            float input[blockSize], delays[blockSize], output[blockSize];
+            double worstError = 0.0;
+
+            for (int start = 0; start + blockSize <= numSamples; start += blockSize)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    input[i] = sine(static_cast<double>(start + i));
+                    delays[i] = SincTable::numTaps / 2 + 0.5f * static_cast<float>(maxDelay - 2 * SincTable::numTaps)
+                                                         * (1.0f + std::sin(0.01f * static_cast<float>(start + i)));
+                }
+
+                line.write(input, blockSize);
+                line.read(interpolation, delays, output, blockSize);
+
+                if (start >= maxDelay)
+                    for (int i = 0; i < blockSize; ++i)
+                        worstError = juce::jmax(worstError, (double) std::abs(output[i] - sine(start + i - (double) delays[i])));
+            }
+
+            expectLessThan(worstError, bound);
+        }
+    }
+
+private:
+    static constexpr int maxDelay = 300;
+    static constexpr int blockSize = 64;
+    static constexpr int numSamples = 8192;
+
+    // Distinct per sample and exact in float, so a read from the wrong slot shows
+    static float ramp(int n) { return static_cast<float>(n % 4096) - 2048.0f; }
+    static float sine(double n) { return static_cast<float>(std::sin(0.2 * juce::MathConstants<double>::pi * n)); }
+};
+
+DelayLineTest delayLineTest;
+
+} // namespace
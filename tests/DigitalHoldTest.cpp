@@ -0,0 +1,98 @@
+#include <JuceHeader.h>
+#include "ModuleTestRig.h"
+#include "../Source/dsp/Digital.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * DigitalHoldTest - checks that Bitcrush's band-limited hold stops the held
+ * steps folding back from the host rate. A 300 Hz sine held at 6.3 kHz, which
+ * does not divide 48 kHz, should only have energy at k * 6300 +- 300 Hz; the
+ * rest is fold-down. It has to stay low whatever the block sizes, since the
+ * step residuals that run past a block carry into the next.
+ */
+class DigitalHoldTest : public juce::UnitTest
+{
+public:
+    DigitalHoldTest() : juce::UnitTest("Digital band-limited hold", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("band-limited hold folds down less than naive");
+        {
+            const double naive = foldDownDb(Digital::HoldMode::Naive, { maxBlockSize });
+            const double bandLimited = foldDownDb(Digital::HoldMode::BandLimited, { maxBlockSize });
+
+            expectLessThan(bandLimited, -40.0);
+            expectLessThan(bandLimited, naive - 12.0);
+        }
+
+        beginTest("band-limited hold carries across blocks");
+        {
+            // Residuals cut off at block ends would fold down more, and more so in short blocks
+            const double whole = foldDownDb(Digital::HoldMode::BandLimited, { maxBlockSize });
+            const double ragged = foldDownDb(Digital::HoldMode::BandLimited, { 1, 13, 64, 200, 7 });
+            expectLessThan(std::abs(ragged - whole), 0.5);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int maxBlockSize = 256;
+    static constexpr double inputHz = 300.0;
+    static constexpr float strobeHz = 6300.0f;
+
+    // Everything repeats every 480 samples, so the spectrum is all on multiples of 100 Hz
+    static constexpr int periodSamples = 480;
+    static constexpr int analysisSamples = 10 * periodSamples;
+
+    // Power away from the held sine's own lines, relative to the power on them, in dB
+    static double foldDownDb(Digital::HoldMode mode, const std::vector<int>& blockSizes)
+    {
+        ModuleTestRig<Digital> rig(sampleRate, maxBlockSize, 1);
+        rig.params.digitalOn = true;
+        rig.params.digitalBits = 16; // Bit reduction mixed out
+        rig.params.digitalSR = strobeHz;
+        rig.params.digitalJitter = 0.0f;
+        rig.params.digitalAA = false;
+        rig.params.digitalSRMode = static_cast<int>(mode);
+        rig.params.macroReallyCheap = 0.0f;
+
+        // Half a second for the strobe rate and the mix to glide in, then the analysis window
+        const int numSamples = 24000 + analysisSamples;
+        const auto output = rig.render([] (int, int n)
+        {
+            return 0.5f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * inputHz * n / sampleRate));
+        }, numSamples, blockSizes);
+
+        const float* window = output[0].data() + numSamples - analysisSamples;
+        double onLines = 0.0, offLines = 0.0;
+
+        for (int bin = 10; bin < analysisSamples / 2; bin += 10)
+        {
+            double re = 0.0, im = 0.0;
+            for (int n = 0; n < analysisSamples; ++n)
+            {
+                const double phase = juce::MathConstants<double>::twoPi * bin * n / analysisSamples;
+                re += window[n] * std::cos(phase);
+                im -= window[n] * std::sin(phase);
+            }
+
+            const double hz = bin * sampleRate / analysisSamples;
+            bool held = false;
+            for (int k = 0; k * strobeHz < sampleRate / 2; ++k)
+                held = held || std::abs(hz - (k * strobeHz + inputHz)) < 1.0 || std::abs(hz - (k * strobeHz - inputHz)) < 1.0;
+
+            (held ? onLines : offLines) += re * re + im * im;
+        }
+
+        return 10.0 * std::log10(offLines / onLines);
+    }
+};
+
+DigitalHoldTest digitalHoldTest;
+
+} // namespace
@@ -0,0 +1,114 @@
+#include <JuceHeader.h>
+#include "ModuleTestRig.h"
+#include "../Source/dsp/Digital.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * DigitalQuantizerTest - checks Bitcrush's bit reduction with the sample rate
+ * left alone: full depth passes the signal untouched, lows under half a step
+ * are gated at 4 bits as a mid-tread quantizer should, the error grows as the
+ * depth falls, and a depth automated every block stays finite and bounded.
+ */
+class DigitalQuantizerTest : public juce::UnitTest
+{
+public:
+    DigitalQuantizerTest() : juce::UnitTest("Digital quantizer", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("full depth is transparent");
+        expectEquals(measure(16, 0.3f, 100.0).error, 0.0);
+
+        beginTest("lows under half a step are gated at 4 bits");
+        {
+            // The lows are driven 4.5x into a step of 2/15, so 0.01 rounds to zero and only
+            // what the 600 Hz crossover lets past as highs is left
+            const double inputRms = 0.01 / std::sqrt(2.0);
+            expectLessThan(measure(4, 0.01f, 50.0).output, 0.2 * inputRms);
+        }
+
+        beginTest("error grows as the depth falls");
+        {
+            double lastError = 0.0;
+            for (int bits : { 14, 11, 8, 5 })
+            {
+                const double error = measure(bits, 0.3f, 100.0).error;
+                expectGreaterThan(error, lastError);
+                lastError = error;
+            }
+        }
+
+        beginTest("automated depth stays bounded");
+        {
+            ModuleTestRig<Digital> rig(sampleRate, blockSize, 1);
+            setUp(rig);
+
+            // A new depth every block, sweeping both ways across the whole range
+            const auto output = rig.render([] (int, int n) { return static_cast<float>(std::sin(0.013 * n)); },
+                                           0, 200 * blockSize, { blockSize },
+                                           [&rig] (int start) { rig.params.digitalBits = 4 + (start / blockSize * 5) % 13; });
+
+            bool bounded = true;
+            for (auto sample : output[0])
+                bounded = bounded && std::isfinite(sample) && std::abs(sample) <= 1.3f;
+
+            expect(bounded);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 256;
+
+    // One Digital with the sample rate reduction mixed out, so only the bit reduction is heard
+    static void setUp(ModuleTestRig<Digital>& rig)
+    {
+        rig.params.digitalOn = true;
+        rig.params.digitalSR = 44100.0f;
+        rig.params.digitalJitter = 0.0f;
+        rig.params.macroReallyCheap = 0.0f;
+    }
+
+    struct Levels
+    {
+        double output = 0.0; // RMS of what comes out
+        double error = 0.0;  // RMS of its difference from the input
+    };
+
+    // Levels for a sine in at the given depth, once the mix has settled
+    static Levels measure(int bits, float amplitude, double frequency)
+    {
+        ModuleTestRig<Digital> rig(sampleRate, blockSize, 1);
+        setUp(rig);
+        rig.params.digitalBits = bits;
+
+        const auto input = [=] (int, int n)
+        {
+            return amplitude * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * frequency * n / sampleRate));
+        };
+
+        const auto output = rig.render(input, 100 * blockSize, { blockSize });
+
+        double outputSum = 0.0, errorSum = 0.0;
+        const int settled = 20 * blockSize;
+        const int counted = (int) output[0].size() - settled;
+
+        for (int n = settled; n < (int) output[0].size(); ++n)
+        {
+            const double sample = output[0][(size_t) n];
+            const double error = sample - input(0, n);
+            outputSum += sample * sample;
+            errorSum += error * error;
+        }
+
+        return { std::sqrt(outputSum / counted), std::sqrt(errorSum / counted) };
+    }
+};
+
+DigitalQuantizerTest digitalQuantizerTest;
+
+} // namespace
@@ -0,0 +1,89 @@
+#include <JuceHeader.h>
+#include "ModuleTestRig.h"
+#include "../Source/dsp/Distort.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * DistortAdaptiveTest - checks the hand-over between Distort's linear and
+ * oversampled paths. A quiet sine runs through two instances, one of which
+ * also gets a loud burst. Where the burst's instance oversamples and where it
+ * hands back, its output must match the instance that never left the linear
+ * path: the oversampler has to be primed, and both paths must line up.
+ */
+class DistortAdaptiveTest : public juce::UnitTest
+{
+public:
+    DistortAdaptiveTest() : juce::UnitTest("Distort adaptive oversampling", "DSP") {}
+
+    void runTest() override
+    {
+        // At 2x the oversampled path shapes with first-order ADAA, a quarter of a host sample
+        // later than the linear one, so the two only agree low in the band
+        struct Case { int oversampling; double frequency; };
+        for (auto c : { Case { 1, 0.02 }, Case { 2, 0.5 * juce::MathConstants<double>::pi },
+                        Case { 3, 0.5 * juce::MathConstants<double>::pi } })
+        {
+            const juce::String name = juce::String(1 << c.oversampling) + "x, "
+                                      + juce::String(c.frequency, 2) + " rad/sample";
+
+            beginTest("primed hand-over to oversampling at " + name);
+            {
+                // The burst starts late in a block, so the crossfade runs over the quiet part
+                const int burstStart = switchBlock * blockSize + 200;
+                expectLessThan(burstDifference(c.oversampling, c.frequency, burstStart, burstStart + blockSize,
+                                               switchBlock * blockSize, burstStart),
+                               0.002);
+            }
+
+            beginTest("hand-back to the linear path at " + name);
+            {
+                // Oversampling holds for 50 ms (2400 samples) after the burst and hands back in the
+                // window; by then the burst has died out of the filters either side of the shaper
+                const int burstEnd = (switchBlock + 2) * blockSize;
+                expectLessThan(burstDifference(c.oversampling, c.frequency, switchBlock * blockSize, burstEnd,
+                                               burstEnd + 2000, burstEnd + 3500),
+                               0.002);
+            }
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 256;
+    static constexpr int switchBlock = 20;
+    static constexpr int numSamples = 64 * blockSize;
+
+    // Largest output difference over [from, to) between an instance given a loud burst over
+    // [burstStart, burstEnd) on top of a quiet sine and one given the sine alone
+    static double burstDifference(int oversampling, double frequency, int burstStart, int burstEnd, int from, int to)
+    {
+        const auto quiet = [frequency] (int n) { return static_cast<float>(0.1 * std::sin(frequency * n)); };
+
+        ModuleTestRig<Distort> withBurst(sampleRate, blockSize, 1), without(sampleRate, blockSize, 1);
+        for (auto* rig : { &withBurst, &without })
+        {
+            rig->params.distortOn = true;
+            rig->params.distortType = 2; // Fold: exactly linear below its knee, so both paths agree there
+            rig->params.distortOversampling = oversampling;
+            rig->params.macroReallyCheap = 0.0f;
+        }
+
+        const auto a = withBurst.render([&] (int, int n)
+        {
+            const bool inBurst = n >= burstStart && n < burstEnd;
+            return inBurst ? static_cast<float>(std::sin(0.3 * n)) + quiet(n) : quiet(n);
+        }, numSamples, { blockSize });
+
+        const auto b = without.render([&] (int, int n) { return quiet(n); }, numSamples, { blockSize });
+
+        return worstDifference(a, b, from, to);
+    }
+};
+
+DistortAdaptiveTest distortAdaptiveTest;
+
+} // namespace
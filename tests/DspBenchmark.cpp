@@ -0,0 +1,488 @@
+#include <JuceHeader.h>
+#include <iostream>
+#include "../Source/core/Params.h"
+#include "../Source/core/ParamSnapshot.h"
+#include "../Source/core/MacroController.h"
+#include "../Source/core/ScratchArena.h"
+#include "../Source/core/BlockRandom.h"
+#include "../Source/dsp/Distort.h"
+#include "../Source/dsp/Wobble.h"
+#include "../Source/dsp/Digital.h"
+#include "../Source/dsp/Magnetic.h"
+#include "../Source/dsp/Noise.h"
+#include "../Source/dsp/Space.h"
+#include "../Source/dsp/shared/HalfbandOversampler.h"
+#include "../Source/dsp/shared/DelayLine.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+ #if defined(_MSC_VER)
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+ #define REALLYCHEAP_HAS_CYCLE_COUNTER 1
+#else
+ #define REALLYCHEAP_HAS_CYCLE_COUNTER 0
+#endif
+
+/**
+ * ReallyCheap-Bench - per-module DSP microbenchmarks.
+ *
+ * Drives each module on its own, without the processor, across sample rates,
+ * block sizes, channel counts and the settings that change its cost the most.
+ * Results are written as JSON so runs can be diffed against a baseline.
+ *
+ * nsPerSample and cyclesPerSample are per channel-sample. Cycles come from the
+ * time-stamp counter on x86 (reference cycles, not core cycles) and are null
+ * on other architectures. Settings that trade accuracy for speed also report
+ * noiseFloorDb, the error they leave relative to the signal.
+ *
+ * Usage:
+ *   ReallyCheap-Bench [--quick] [--module <name>] [--output <file.json>]
+ */
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+struct BenchOptions
+{
+    bool quick = false;
+    juce::String moduleFilter;
+    juce::File output;
+};
+
+struct BenchConfig
+{
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int numChannels = 2;
+};
+
+struct Timing
+{
+    double nsPerSample = 0.0;
+    double cyclesPerSample = 0.0;
+};
+
+using Runner = std::function<Timing(const ParamSnapshot&, const BenchConfig&, double)>;
+
+struct Setting
+{
+    juce::String name;
+    std::function<void(ParamSnapshot&)> apply;
+    Runner run {}; // Replaces the module's runner for this setting when set
+    std::function<double(double)> measureNoiseFloor {}; // dB at the given sample rate, when set
+};
+
+inline juce::uint64 readCycleCounter() noexcept
+{
+   #if REALLYCHEAP_HAS_CYCLE_COUNTER
+    return static_cast<juce::uint64>(__rdtsc());
+   #else
+    return 0;
+   #endif
+}
+
+// Modules all sleep on silence, so drive them with steady noise at -12 dBFS
+void fillWithNoise(juce::AudioBuffer<float>& buffer)
+{
+    juce::Random random(0x5eed);
+
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        auto* data = buffer.getWritePointer(ch);
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+            data[i] = (random.nextFloat() * 2.0f - 1.0f) * 0.25f;
+    }
+}
+
+/**
+ * Modulation noise of one delay-line read tier: a 10 kHz sine through a delay
+ * swept over 2 ms at 6 Hz, Wobble's full depth at flutter rate, against the
+ * exact delayed sine. Lower is cleaner.
+ */
+double measureModulationNoiseDb(DelayInterpolation interpolation, double sampleRate)
+{
+    constexpr int blockSize = 256;
+    const double sweepSamples = 0.002 * sampleRate;
+    const double baseDelay = SincTable::numTaps;
+    const double omega = juce::MathConstants<double>::twoPi * 10000.0 / sampleRate;
+    const double sweepOmega = juce::MathConstants<double>::twoPi * 6.0 / sampleRate;
+
+    DelayLine<float> line;
+    line.prepare(static_cast<int>(baseDelay + sweepSamples) + 1, blockSize);
+
+    float input[blockSize], delays[blockSize], output[blockSize];
+    double signalEnergy = 0.0, errorEnergy = 0.0;
+    const int numBlocks = static_cast<int>(sampleRate) / blockSize;
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        for (int i = 0; i < blockSize; ++i)
+        {
+            const double n = static_cast<double>(block * blockSize + i);
+            input[i] = static_cast<float>(std::sin(omega * n));
+            delays[i] = static_cast<float>(baseDelay + 0.5 * sweepSamples * (1.0 + std::sin(sweepOmega * n)));
+        }
+
+        line.write(input, blockSize);
+        line.read(interpolation, delays, output, blockSize);
+
+        // Skip the first blocks, while the reads still reach back before the start
+        if (block < 4)
+            continue;
+
+        for (int i = 0; i < blockSize; ++i)
+        {
+            const double expected = std::sin(omega * (static_cast<double>(block * blockSize + i) - delays[i]));
+            signalEnergy += expected * expected;
+            errorEnergy += (output[i] - expected) * (output[i] - expected);
+        }
+    }
+
+    return juce::Decibels::gainToDecibels(std::sqrt(errorEnergy / signalEnergy), -200.0);
+}
+
+/**
+ * Oversampling engines round-tripped with nothing in between, so they can be
+ * compared on their own: HalfbandOversampler against juce::dsp::Oversampling
+ * at maximum quality with integer latency, which rejects images by 90 dB on
+ * the way up and 75 dB on the way down at the first stage. The halfband
+ * stages are designed for 90 dB both ways.
+ */
+class OversamplingRoundTrip
+{
+public:
+    enum class Engine
+    {
+        halfbandLinear,
+        halfbandMinimum,
+        juceEquiripple,
+        juceIir
+    };
+
+    OversamplingRoundTrip(Engine engineToUse, int numStages) : engine(engineToUse), stages(numStages) {}
+
+    void setScratchArena(ScratchArena&) noexcept {}
+
+    void prepare(double, int samplesPerBlock, int numChannels)
+    {
+        if (engine == Engine::halfbandLinear || engine == Engine::halfbandMinimum)
+        {
+            halfband.prepare(numChannels, samplesPerBlock, stages,
+                             engine == Engine::halfbandLinear ? HalfbandOversampler::Phase::linear
+                                                              : HalfbandOversampler::Phase::minimum);
+            return;
+        }
+
+        juceOversampler = std::make_unique<juce::dsp::Oversampling<float>>(
+            numChannels, static_cast<size_t>(stages),
+            engine == Engine::juceEquiripple ? juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple
+                                             : juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+            true, true);
+        juceOversampler->initProcessing(static_cast<size_t>(samplesPerBlock));
+    }
+
+    void process(juce::AudioBuffer<float>& buffer, juce::AudioPlayHead*, const ParamSnapshot&, const MacroController&) noexcept
+    {
+        juce::dsp::AudioBlock<float> block(buffer);
+
+        if (juceOversampler != nullptr)
+        {
+            juceOversampler->processSamplesUp(block);
+            juceOversampler->processSamplesDown(block);
+        }
+        else
+        {
+            halfband.processSamplesUp(block);
+            halfband.processSamplesDown(block);
+        }
+    }
+
+private:
+    Engine engine;
+    int stages;
+    HalfbandOversampler halfband;
+    std::unique_ptr<juce::dsp::Oversampling<float>> juceOversampler;
+};
+
+template <typename Module>
+Timing runModule(Module& module, const ParamSnapshot& params, const BenchConfig& config, double secondsOfAudio)
+{
+    MacroController macro;
+    macro.prepare(config.sampleRate, config.blockSize);
+
+    ScratchArena scratchArena;
+    scratchArena.prepare(config.numChannels, config.blockSize, 3);
+
+    // Fixed seed so every run draws the same noise
+    BlockRandom blockRandom;
+    blockRandom.setSeed(0x5eed);
+
+    if constexpr (! std::is_same_v<Module, Distort>)
+        module.setScratchArena(scratchArena);
+
+    if constexpr (std::is_same_v<Module, Wobble> || std::is_same_v<Module, Digital> || std::is_same_v<Module, Magnetic>)
+        module.setBlockRandom(blockRandom);
+    
+    // Neighbouring channels paired, as for discrete stems
+    if constexpr (std::is_same_v<Module, Wobble> || std::is_same_v<Module, Magnetic>
+                  || std::is_same_v<Module, Noise> || std::is_same_v<Module, Space>)
+    {
+        ChannelPairs channelPairs;
+        channelPairs.setAdjacentPairs(config.numChannels);
+        module.setChannelPairs(channelPairs);
+    }
+
+    module.prepare(config.sampleRate, config.blockSize, config.numChannels);
+
+    const int numBlocks = juce::jmax(8, static_cast<int>(secondsOfAudio * config.sampleRate) / config.blockSize);
+    const int totalSamples = numBlocks * config.blockSize;
+
+    juce::AudioBuffer<float> signal(config.numChannels, totalSamples);
+
+    auto processAll = [&]
+    {
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            juce::AudioBuffer<float> view(signal.getArrayOfWritePointers(), config.numChannels,
+                                          block * config.blockSize, config.blockSize);
+            macro.tick(params);
+            scratchArena.rewind();
+            module.process(view, nullptr, params, macro);
+        }
+    };
+
+    // One untimed pass to settle smoothers and warm the caches
+    fillWithNoise(signal);
+    processAll();
+
+    // Best of three keeps scheduler noise out of the baseline
+    Timing best { std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+    const double channelSamples = static_cast<double>(totalSamples) * config.numChannels;
+
+    for (int run = 0; run < 3; ++run)
+    {
+        fillWithNoise(signal);
+
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const auto startCycles = readCycleCounter();
+
+        processAll();
+
+        const auto endCycles = readCycleCounter();
+        const auto seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+
+        best.nsPerSample = juce::jmin(best.nsPerSample, seconds * 1.0e9 / channelSamples);
+        best.cyclesPerSample = juce::jmin(best.cyclesPerSample, static_cast<double>(endCycles - startCycles) / channelSamples);
+    }
+
+    return best;
+}
+
+struct ModuleBench
+{
+    juce::String name;
+    juce::Array<Setting> settings;
+    Runner run;
+};
+
+template <typename Module>
+Runner makeRunner()
+{
+    return [](const ParamSnapshot& params, const BenchConfig& config, double seconds)
+    {
+        Module module;
+        return runModule(module, params, config, seconds);
+    };
+}
+
+juce::Array<ModuleBench> createModuleBenches()
+{
+    juce::Array<ModuleBench> benches;
+
+    {
+        ModuleBench bench { "Distort", {}, makeRunner<Distort>() };
+        const auto types = ParameterHelper::getDistortTypeChoices();
+        for (int type = 0; type < types.size(); ++type)
+            bench.settings.add({ "type=" + types[type], [type](ParamSnapshot& p) { p.distortOn = true; p.distortType = type; } });
+        const auto factors = ParameterHelper::getDistortOversamplingChoices();
+        for (int factor = 0; factor < factors.size(); ++factor)
+            bench.settings.add({ "os=" + factors[factor],
+                                 [factor](ParamSnapshot& p) { p.distortOn = true; p.distortOversampling = factor; } });
+        benches.add(bench);
+    }
+
+    {
+        ModuleBench bench { "Wobble", {}, makeRunner<Wobble>() };
+        const auto qualities = ParameterHelper::getWobbleQualityChoices();
+        for (int quality = 0; quality < qualities.size(); ++quality)
+            bench.settings.add({ "quality=" + qualities[quality],
+                                 [quality](ParamSnapshot& p) { p.wobbleOn = true; p.wobbleQuality = quality; }, {},
+                                 [quality](double sampleRate)
+                                 {
+                                     return measureModulationNoiseDb(static_cast<DelayInterpolation>(quality), sampleRate);
+                                 } });
+        benches.add(bench);
+    }
+
+    {
+        ModuleBench bench { "Digital", {}, makeRunner<Digital>() };
+        for (int bits : { 4, 8, 12, 16 })
+            bench.settings.add({ "bits=" + juce::String(bits), [bits](ParamSnapshot& p) { p.digitalOn = true; p.digitalBits = bits; } });
+        for (int mode : { 0, 1 })
+            bench.settings.add({ "hold=" + ParameterHelper::getDigitalSRModeChoices()[mode],
+                                 [mode](ParamSnapshot& p) { p.digitalOn = true; p.digitalSR = 8000.0f; p.digitalSRMode = mode; } });
+        benches.add(bench);
+    }
+
+    {
+        // The hysteresis solvers side by side with the tanh curve they replace
+        ModuleBench bench { "Magnetic", { { "sat=tanh", [](ParamSnapshot& p) { p.magOn = true; } } }, makeRunner<Magnetic>() };
+        const auto solvers = ParameterHelper::getMagHysteresisQualityChoices();
+        for (int solver = 0; solver < solvers.size(); ++solver)
+            bench.settings.add({ "sat=hysteresis " + solvers[solver],
+                                 [solver](ParamSnapshot& p) { p.magOn = true; p.magSatMode = 1; p.magHysteresisQuality = solver; } });
+        benches.add(bench);
+    }
+
+    benches.add({ "Noise", { { "default", [](ParamSnapshot& p) { p.noiseOn = true; } } }, makeRunner<Noise>() });
+
+    {
+        ModuleBench bench { "Space", {}, makeRunner<Space>() };
+        for (float time : { 0.0f, 0.5f, 1.0f })
+            bench.settings.add({ "time=" + juce::String(time, 1), [time](ParamSnapshot& p) { p.spaceOn = true; p.spaceTime = time; } });
+        benches.add(bench);
+    }
+
+    {
+        using Engine = OversamplingRoundTrip::Engine;
+        const std::pair<Engine, const char*> engines[] { { Engine::halfbandLinear, "halfband-linear" },
+                                                         { Engine::halfbandMinimum, "halfband-minimum" },
+                                                         { Engine::juceEquiripple, "juce-fir" },
+                                                         { Engine::juceIir, "juce-iir" } };
+
+        ModuleBench bench { "Oversampling", {}, {} };
+        for (const auto& [engine, engineName] : engines)
+            for (int stages = 1; stages <= 3; ++stages)
+                bench.settings.add({ juce::String(engineName) + " " + juce::String(1 << stages) + "x", [](ParamSnapshot&) {},
+                                     [engine = engine, stages](const ParamSnapshot& params, const BenchConfig& config, double seconds)
+                                     {
+                                         OversamplingRoundTrip roundTrip(engine, stages);
+                                         return runModule(roundTrip, params, config, seconds);
+                                     } });
+        benches.add(bench);
+    }
+
+    return benches;
+}
+
+bool parseArguments(int argc, char* argv[], BenchOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--quick" || arg == "-q")
+            options.quick = true;
+        else if ((arg == "--module" || arg == "-m") && hasValue)
+            options.moduleFilter = argv[++i];
+        else if ((arg == "--output" || arg == "-o") && hasValue)
+            options.output = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    if (! parseArguments(argc, argv, options))
+    {
+        std::cout << "Usage: ReallyCheap-Bench [--quick] [--module <name>] [--output <file.json>]\n";
+        return 1;
+    }
+
+    // Noise assets are decoded through the message-thread singletons, as in the plugin
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    NoiseAssetManager::getInstance().loadAssetsFromBinaryData();
+
+    const juce::Array<double> sampleRates = options.quick ? juce::Array<double> { 48000.0 }
+                                                          : juce::Array<double> { 44100.0, 48000.0, 96000.0, 192000.0 };
+    const juce::Array<int> blockSizes = options.quick ? juce::Array<int> { 64, 512 }
+                                                      : juce::Array<int> { 1, 16, 64, 256, 1024, 4096 };
+    const juce::Array<int> channelCounts { 1, 2, 6 };
+    const double secondsOfAudio = options.quick ? 0.1 : 0.25;
+
+    juce::Array<juce::var> results;
+
+    for (const auto& bench : createModuleBenches())
+    {
+        if (options.moduleFilter.isNotEmpty() && ! bench.name.equalsIgnoreCase(options.moduleFilter))
+            continue;
+
+        for (const auto& setting : bench.settings)
+        {
+            // Everything off except the module under test
+            ParamSnapshot params;
+            params.noiseOn = params.wobbleOn = params.distortOn = false;
+            params.digitalOn = params.spaceOn = params.magOn = false;
+            setting.apply(params);
+
+            for (auto sampleRate : sampleRates)
+            {
+                const auto noiseFloor = setting.measureNoiseFloor ? juce::var(setting.measureNoiseFloor(sampleRate)) : juce::var();
+
+                for (auto blockSize : blockSizes)
+                    for (auto numChannels : channelCounts)
+                    {
+                        const BenchConfig config { sampleRate, blockSize, numChannels };
+                        const auto& run = setting.run ? setting.run : bench.run;
+                        const auto timing = run(params, config, secondsOfAudio);
+
+                        auto* result = new juce::DynamicObject();
+                        result->setProperty("module", bench.name);
+                        result->setProperty("setting", setting.name);
+                        result->setProperty("sampleRate", sampleRate);
+                        result->setProperty("blockSize", blockSize);
+                        result->setProperty("channels", numChannels);
+                        result->setProperty("nsPerSample", timing.nsPerSample);
+                        result->setProperty("cyclesPerSample", REALLYCHEAP_HAS_CYCLE_COUNTER ? juce::var(timing.cyclesPerSample)
+                                                                                             : juce::var());
+                        if (! noiseFloor.isVoid())
+                            result->setProperty("noiseFloorDb", noiseFloor);
+                        results.add(juce::var(result));
+
+                        std::cerr << bench.name << " " << setting.name << " " << sampleRate << " Hz, block "
+                                  << blockSize << ", " << numChannels << " ch: "
+                                  << juce::String(timing.nsPerSample, 2) << " ns/sample"
+                                  << (noiseFloor.isVoid() ? juce::String() : ", noise " + juce::String((double) noiseFloor, 1) + " dB")
+                                  << "\n";
+                    }
+            }
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty("cycleCounter", REALLYCHEAP_HAS_CYCLE_COUNTER ? juce::var("tsc") : juce::var());
+    report->setProperty("results", results);
+
+    const auto json = juce::JSON::toString(juce::var(report));
+
+    if (options.output == juce::File())
+        std::cout << json << "\n";
+    else if (! options.output.replaceWithText(json))
+    {
+        std::cerr << "Could not write " << options.output.getFullPathName() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <JuceHeader.h>
+#include <iostream>
+
+/**
+ * ReallyCheap-Tests - runs the DSP unit tests registered in this target.
+ *
+ * Exits with 1 if any expectation failed, so CTest can run it as is.
+ *
+ * Usage:
+ *   ReallyCheap-Tests
+ */
+int main()
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runTestsInCategory("DSP");
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult(i)->failures;
+
+    if (failures > 0)
+    {
+        std::cout << failures << " expectation(s) failed\n";
+        return 1;
+    }
+
+    std::cout << "All tests passed\n";
+    return 0;
+}
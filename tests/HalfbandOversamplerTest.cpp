@@ -0,0 +1,135 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/shared/HalfbandOversampler.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+using Phase = HalfbandOversampler::Phase;
+
+/**
+ * HalfbandOversamplerTest - checks the round trip of every factor and design:
+ * the reported latency, unity gain in the passband, and how far down the
+ * images of a passband tone are in the oversampled signal.
+ */
+class HalfbandOversamplerTest : public juce::UnitTest
+{
+public:
+    HalfbandOversamplerTest() : juce::UnitTest("Halfband oversampler", "DSP") {}
+
+    void runTest() override
+    {
+        for (auto phase : { Phase::linear, Phase::minimum })
+        {
+            for (int stages = 1; stages <= 3; ++stages)
+            {
+                const juce::String design = phase == Phase::linear ? "linear" : "minimum";
+                beginTest(design + " phase, " + juce::String(1 << stages) + "x");
+
+                HalfbandOversampler oversampler;
+                oversampler.prepare(1, blockSize, stages, phase);
+
+                // An impulse comes back centred on the latency, to the sample for linear phase
+                const auto impulse = roundTrip(oversampler, [] (int i) { return i == impulseAt ? 1.0f : 0.0f; }, nullptr);
+                const int latency = oversampler.getLatencySamples();
+                const double delay = centreOfMass(impulse) - impulseAt;
+
+                if (phase == Phase::linear)
+                {
+                    expectWithinAbsoluteError(delay, static_cast<double>(latency), 1.0e-3);
+                    for (int k = 1; k < 32; ++k)
+                        expectWithinAbsoluteError(impulse[(size_t) (impulseAt + latency + k)],
+                                                  impulse[(size_t) (impulseAt + latency - k)], 1.0e-6f);
+                }
+                else
+                {
+                    expectWithinAbsoluteError(delay, static_cast<double>(latency), 0.5);
+                    expectLessThan(latency, 8);
+                }
+
+                // A tone near the top of the passband keeps its level and leaves no images
+                const double frequency = 0.43;
+                std::vector<float> upsampled;
+                const auto tone = roundTrip(oversampler, [frequency] (int i)
+                {
+                    return static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * frequency * i));
+                }, &upsampled);
+
+                expectWithinAbsoluteError(levelAt(tone, frequency), 1.0, 0.005);
+
+                const int factor = oversampler.getFactor();
+                double worstImage = 0.0;
+                for (int k = 1; k < factor; ++k)
+                    for (double image : { k - frequency, k + frequency })
+                        worstImage = juce::jmax(worstImage, levelAt(upsampled, image / factor));
+
+                expectLessThan(juce::Decibels::gainToDecibels(worstImage), -70.0);
+            }
+        }
+    }
+
+private:
+    static constexpr int blockSize = 64;
+    static constexpr int numSamples = 8192;
+    static constexpr int impulseAt = 100;
+
+    // Runs numSamples of signal(i) up and straight back down in blocks, keeping the oversampled signal if asked
+    template <typename Signal>
+    static std::vector<float> roundTrip(HalfbandOversampler& oversampler, Signal&& signal, std::vector<float>* upsampled)
+    {
+        oversampler.reset();
+
+        std::vector<float> data((size_t) numSamples);
+        for (int i = 0; i < numSamples; ++i)
+            data[(size_t) i] = signal(i);
+
+        for (int start = 0; start < numSamples; start += blockSize)
+        {
+            float* channel = data.data() + start;
+            juce::dsp::AudioBlock<float> block(&channel, 1, (size_t) blockSize);
+            const auto oversampled = oversampler.processSamplesUp(block);
+
+            if (upsampled != nullptr)
+                upsampled->insert(upsampled->end(), oversampled.getChannelPointer(0),
+                                  oversampled.getChannelPointer(0) + oversampled.getNumSamples());
+
+            oversampler.processSamplesDown(block);
+        }
+
+        return data;
+    }
+
+    static double centreOfMass(const std::vector<float>& impulse)
+    {
+        double sum = 0.0, moment = 0.0;
+        for (size_t i = 0; i < impulse.size(); ++i)
+        {
+            sum += impulse[i];
+            moment += static_cast<double>(i) * impulse[i];
+        }
+
+        return moment / sum;
+    }
+
+    // Amplitude at a normalised frequency over the second half of signal, Hann-windowed
+    static double levelAt(const std::vector<float>& signal, double frequency)
+    {
+        const size_t start = signal.size() / 2;
+        const double length = static_cast<double>(signal.size() - start);
+        double re = 0.0, im = 0.0;
+
+        for (size_t i = start; i < signal.size(); ++i)
+        {
+            const double window = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * static_cast<double>(i - start) / length);
+            const double phase = juce::MathConstants<double>::twoPi * frequency * static_cast<double>(i);
+            re += window * signal[i] * std::cos(phase);
+            im += window * signal[i] * std::sin(phase);
+        }
+
+        return 4.0 * std::sqrt(re * re + im * im) / length;
+    }
+};
+
+HalfbandOversamplerTest halfbandOversamplerTest;
+
+} // namespace
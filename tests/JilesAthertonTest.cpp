@@ -0,0 +1,126 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/shared/JilesAtherton.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * JilesAthertonTest - checks that the hysteresis loop opens and is symmetric,
+ * that every solver traces the same loop, that each lane of a group runs on
+ * its own, and that no field, however sudden, takes the magnetisation past
+ * saturation.
+ */
+class JilesAthertonTest : public juce::UnitTest
+{
+public:
+    JilesAthertonTest() : juce::UnitTest("Jiles-Atherton hysteresis", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("loop opens and is symmetric");
+        {
+            JilesAtherton model;
+            model.prepare(sampleRate);
+
+            // Magnetisation where the field crosses zero on the way up and on the way down,
+            // once the loop has settled
+            float rising = 0.0f, falling = 0.0f;
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const float m = model.processSample(LaneVector(field(n)), HysteresisSolver::rk4).get(0);
+
+                if (n >= numSamples - cycleSamples)
+                {
+                    const int phase = n % cycleSamples;
+                    if (phase == 0)
+                        rising = m;
+                    else if (phase == cycleSamples / 2)
+                        falling = m;
+                }
+            }
+
+            expectGreaterThan(falling, 0.05f);
+            expectLessThan(std::abs(rising + falling), 1.0e-3f);
+        }
+
+        beginTest("solvers agree");
+        {
+            std::vector<float> reference(numSamples);
+            JilesAtherton model;
+            model.prepare(sampleRate);
+            for (int n = 0; n < numSamples; ++n)
+                reference[(size_t) n] = model.processSample(LaneVector(field(n)), HysteresisSolver::newton8).get(0);
+
+            for (auto solver : { HysteresisSolver::rk2, HysteresisSolver::rk4, HysteresisSolver::newton4 })
+            {
+                model.reset();
+                double worstError = 0.0;
+                for (int n = 0; n < numSamples; ++n)
+                {
+                    const float m = model.processSample(LaneVector(field(n)), solver).get(0);
+                    worstError = juce::jmax(worstError, (double) std::abs(m - reference[(size_t) n]));
+                }
+
+                expectLessThan(worstError, 1.0e-3);
+            }
+        }
+
+        beginTest("lanes are independent");
+        {
+            JilesAtherton model;
+            model.prepare(sampleRate);
+
+            // The first lane driven, the rest silent
+            alignas(sizeof(LaneVector)) float lanes[laneWidth] = {};
+            bool othersSilent = true;
+            for (int n = 0; n < numSamples; ++n)
+            {
+                lanes[0] = field(n);
+                const auto m = model.processSample(LaneVector::fromRawArray(lanes), HysteresisSolver::rk2);
+                for (int lane = 1; lane < laneWidth; ++lane)
+                    othersSilent = othersSilent && m.get((size_t) lane) == 0.0f;
+            }
+
+            expect(othersSilent);
+        }
+
+        beginTest("sudden fields stay bounded");
+        {
+            juce::Random random(0x1a);
+
+            for (auto solver : { HysteresisSolver::rk2, HysteresisSolver::rk4, HysteresisSolver::newton4, HysteresisSolver::newton8 })
+            {
+                JilesAtherton model;
+                model.prepare(sampleRate);
+
+                bool bounded = true;
+                for (int n = 0; n < numSamples; ++n)
+                {
+                    // Jumps of up to a thousand times the field that saturates the tape
+                    const float jump = (random.nextFloat() * 2.0f - 1.0f) * (n % 97 == 0 ? 1000.0f : 20.0f);
+                    const float m = model.processSample(LaneVector(jump), solver).get(0);
+                    bounded = bounded && std::isfinite(m) && std::abs(m) <= 1.0f;
+                }
+
+                expect(bounded);
+            }
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 96000.0;
+    static constexpr int cycleSamples = 960; // 100 Hz
+    static constexpr int numSamples = 8 * cycleSamples;
+
+    // A sine well into saturation, starting at zero on the way up
+    static float field(int n)
+    {
+        return 2.0f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * n / cycleSamples));
+    }
+};
+
+JilesAthertonTest jilesAthertonTest;
+
+} // namespace
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Source/core/BlockRandom.h"
+#include "../Source/core/MacroController.h"
+#include "../Source/core/ParamSnapshot.h"
+#include "../Source/core/ScratchArena.h"
+
+namespace ReallyCheap
+{
+
+/**
+ * ModuleTestRig - one DSP module wired up the way the processor wires it,
+ * for tests that drive it block by block. The macro is ticked once a block
+ * before the module runs, and the module draws on the rig's scratch arena and
+ * on a noise generator seeded the same every time, so runs are repeatable.
+ */
+template <typename Module>
+struct ModuleTestRig
+{
+    ModuleTestRig(double sampleRate, int maxBlockSize, int numChannels)
+        : blockSize(maxBlockSize), channels(numChannels)
+    {
+        macro.prepare(sampleRate, maxBlockSize);
+        arena.prepare(numChannels, maxBlockSize, 3);
+        random.setSeed(1);
+        connectScratchArena(module, arena, 0);
+        connectBlockRandom(module, random, 0);
+        module.prepare(sampleRate, maxBlockSize, numChannels);
+    }
+
+    void process(juce::AudioBuffer<float>& buffer)
+    {
+        macro.tick(params);
+        module.process(buffer, playHead, params, macro);
+    }
+
+    // Every channel's output for input(channel, sample) from firstSample up to endSample, cut into
+    // blocks of the given sizes in turn, with beforeBlock(start) run ahead of each block. Blocks
+    // longer than the prepared size are handed over whole. Output before firstSample is left at zero.
+    template <typename Input, typename BeforeBlock>
+    std::vector<std::vector<float>> render(Input&& input, int firstSample, int endSample,
+                                           const std::vector<int>& blockSizes, BeforeBlock&& beforeBlock)
+    {
+        const int largestBlock = *std::max_element(blockSizes.begin(), blockSizes.end());
+        std::vector<std::vector<float>> output((size_t) channels, std::vector<float>((size_t) endSample));
+        juce::AudioBuffer<float> buffer(channels, largestBlock);
+
+        for (int start = firstSample, block = 0; start < endSample; ++block)
+        {
+            const int size = juce::jmin(blockSizes[(size_t) block % blockSizes.size()], endSample - start);
+            juce::AudioBuffer<float> view(buffer.getArrayOfWritePointers(), channels, size);
+
+            for (int ch = 0; ch < channels; ++ch)
+                for (int i = 0; i < size; ++i)
+                    view.setSample(ch, i, input(ch, start + i));
+
+            beforeBlock(start);
+            process(view);
+
+            for (int ch = 0; ch < channels; ++ch)
+                std::copy(view.getReadPointer(ch), view.getReadPointer(ch) + size, output[(size_t) ch].begin() + start);
+
+            start += size;
+        }
+
+        return output;
+    }
+
+    template <typename Input>
+    std::vector<std::vector<float>> render(Input&& input, int numSamples, const std::vector<int>& blockSizes)
+    {
+        return render(std::forward<Input>(input), 0, numSamples, blockSizes, [] (int) {});
+    }
+
+    const int blockSize;
+    const int channels;
+    ParamSnapshot params;
+    juce::AudioPlayHead* playHead = nullptr; // handed to the module with every block
+    MacroController macro;
+    ScratchArena arena;
+    BlockRandom random;
+    Module module;
+
+private:
+    // Only the modules that take an arena or a noise generator are given one
+    template <typename Target>
+    static auto connectScratchArena(Target& target, ScratchArena& scratch, int) -> decltype(target.setScratchArena(scratch))
+    {
+        target.setScratchArena(scratch);
+    }
+
+    template <typename Target>
+    static void connectScratchArena(Target&, ScratchArena&, long) {}
+
+    template <typename Target>
+    static auto connectBlockRandom(Target& target, BlockRandom& generator, int) -> decltype(target.setBlockRandom(generator))
+    {
+        target.setBlockRandom(generator);
+    }
+
+    template <typename Target>
+    static void connectBlockRandom(Target&, BlockRandom&, long) {}
+};
+
+// Largest difference between two signals over [from, to), or from onwards when to is left out
+inline double worstDifference(const std::vector<float>& a, const std::vector<float>& b, int from = 0, int to = -1)
+{
+    const size_t end = to < 0 ? a.size() : (size_t) to;
+    double worst = 0.0;
+    for (size_t i = (size_t) from; i < end; ++i)
+        worst = juce::jmax(worst, (double) std::abs(a[i] - b[i]));
+
+    return worst;
+}
+
+// As above, over every channel
+inline double worstDifference(const std::vector<std::vector<float>>& a, const std::vector<std::vector<float>>& b,
+                              int from = 0, int to = -1)
+{
+    double worst = 0.0;
+    for (size_t ch = 0; ch < a.size(); ++ch)
+        worst = juce::jmax(worst, worstDifference(a[ch], b[ch], from, to));
+
+    return worst;
+}
+
+}
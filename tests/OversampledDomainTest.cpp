@@ -0,0 +1,89 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/shared/OversampledDomain.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * OversampledDomainTest - checks that a linear pass through the domain lines up
+ * with the dry path it delays, low in the band and high up where any phase error
+ * in the filters would cancel the mix, and that an inactive domain hands the
+ * host buffer straight through.
+ */
+class OversampledDomainTest : public juce::UnitTest
+{
+public:
+    OversampledDomainTest() : juce::UnitTest("Oversampled domain", "DSP") {}
+
+    void runTest() override
+    {
+        for (int factor : { 2, 4 })
+        {
+            OversampledDomain domain;
+            domain.prepare(2, blockSize, factor);
+            expectEquals(domain.getFactor(), factor);
+
+            int seenSamples = -1;
+
+            // Radians per sample: well down in the band, and half way to Nyquist
+            for (double frequency : { 0.05, 0.5 * juce::MathConstants<double>::pi })
+            {
+                beginTest("wet and dry line up at " + juce::String(factor) + "x, "
+                          + juce::String(frequency, 2) + " rad/sample");
+
+                domain.reset();
+                double worstError = 0.0;
+
+                for (int start = 0; start < numSamples; start += blockSize)
+                {
+                    juce::AudioBuffer<float> wet(2, blockSize), dry(2, blockSize);
+                    for (int ch = 0; ch < 2; ++ch)
+                        for (int i = 0; i < blockSize; ++i)
+                            wet.setSample(ch, i, static_cast<float>(0.5 * std::sin(frequency * (start + i) + ch)));
+
+                    dry.makeCopyOf(wet);
+
+                    domain.process(wet, true, [&seenSamples] (juce::AudioBuffer<float>& block)
+                    {
+                        seenSamples = block.getNumSamples();
+                    });
+                    domain.alignDryPath(dry);
+
+                    // Past the start-up transient a linear pass differs from the delayed dry only by the filter ripple
+                    if (start >= 4 * blockSize)
+                        for (int ch = 0; ch < 2; ++ch)
+                            for (int i = 0; i < blockSize; ++i)
+                                worstError = juce::jmax(worstError, (double) std::abs(wet.getSample(ch, i) - dry.getSample(ch, i)));
+                }
+
+                expectEquals(seenSamples, blockSize * factor);
+                expectLessThan(worstError, 0.01);
+            }
+
+            beginTest("inactive at " + juce::String(factor) + "x");
+
+            juce::AudioBuffer<float> buffer(2, blockSize);
+            buffer.clear();
+            buffer.setSample(0, 10, 1.0f);
+
+            domain.process(buffer, false, [&seenSamples] (juce::AudioBuffer<float>& block)
+            {
+                seenSamples = block.getNumSamples();
+            });
+            domain.alignDryPath(buffer);
+
+            expectEquals(seenSamples, blockSize);
+            expectEquals(buffer.getSample(0, 10), 1.0f);
+        }
+    }
+
+private:
+    static constexpr int blockSize = 64;
+    static constexpr int numSamples = 4096;
+};
+
+OversampledDomainTest oversampledDomainTest;
+
+} // namespace
@@ -0,0 +1,102 @@
+#include <JuceHeader.h>
+#include "../Source/dsp/Distort.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+using DistortType = Distort::DistortType;
+
+// The shapers as they were before they became branch-free kernels, with std::tanh
+struct Reference
+{
+    static float tape(float input)
+    {
+        const float biased = input + 0.05f * input * input;
+        const float x = biased * 0.7f;
+        const float x2 = x * x;
+        const float output = x * (27.0f + x2) / (27.0f + 9.0f * x2);
+        return output + 0.02f * output * output * (input > 0 ? 1.0f : -1.0f);
+    }
+
+    static float diode(float input)
+    {
+        const float threshold = 0.5f;
+        const float softness = 0.8f;
+
+        if (input >= 0.0f)
+            return input < threshold ? input
+                                     : threshold + (1.0f - threshold) * std::tanh((input - threshold) * softness);
+
+        const float negThreshold = threshold * 0.8f;
+        return input > -negThreshold ? input
+                                     : -negThreshold - (1.0f - negThreshold) * std::tanh((-input - negThreshold) * softness * 1.2f);
+    }
+
+    static float fold(float input)
+    {
+        const float foldThreshold = 0.8f;
+        const float absInput = std::abs(input);
+
+        if (absInput <= foldThreshold)
+            return input;
+
+        const float excess = absInput - foldThreshold;
+        const float foldedExcess = juce::jmax(foldThreshold - excess * 0.3f, foldThreshold * 0.5f);
+        const float folded = input >= 0.0f ? foldedExcess : -foldedExcess;
+        const float blend = juce::jlimit(0.0f, 0.6f, excess * 2.0f);
+        return input * (1.0f - blend) + folded * blend;
+    }
+};
+
+/**
+ * ShaperAccuracyTest - bounds the error of Distort's vectorizable shaper kernels
+ * and fastTanh against straightforward reference versions, over more than the
+ * input range full drive can reach.
+ */
+class ShaperAccuracyTest : public juce::UnitTest
+{
+public:
+    ShaperAccuracyTest() : juce::UnitTest("Shaper accuracy", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("fastTanh");
+        expectLessThan(maxError(fastTanh, [] (float x) { return std::tanh(x); }), 1.0e-4f);
+
+        beginTest("Tape");
+        expectLessThan(maxError(Distort::shape<DistortType::Tape>, Reference::tape), 1.0e-5f);
+
+        beginTest("Diode");
+        expectLessThan(maxError(Distort::shape<DistortType::Diode>, Reference::diode), 1.0e-4f);
+
+        beginTest("Fold");
+        expectLessThan(maxError(Distort::shape<DistortType::Fold>, Reference::fold), 1.0e-5f);
+
+        beginTest("Odd symmetry of fastTanh");
+        for (float x = 0.0f; x < 8.0f; x += 0.01f)
+            expectEquals(fastTanh(-x), -fastTanh(x));
+    }
+
+private:
+    // Largest absolute difference over a dense sweep of -64..64
+    template <typename Fast, typename Exact>
+    static float maxError(Fast&& fast, Exact&& exact)
+    {
+        constexpr int numPoints = 1 << 20;
+        constexpr float range = 64.0f;
+        float worst = 0.0f;
+
+        for (int i = 0; i <= numPoints; ++i)
+        {
+            const float x = -range + 2.0f * range * static_cast<float>(i) / static_cast<float>(numPoints);
+            worst = juce::jmax(worst, std::abs(fast(x) - exact(x)));
+        }
+
+        return worst;
+    }
+};
+
+ShaperAccuracyTest shaperAccuracyTest;
+
+} // namespace
@@ -0,0 +1,94 @@
+#include <JuceHeader.h>
+#include "ModuleTestRig.h"
+#include "../Source/dsp/Wobble.h"
+#include "../Source/core/Params.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * WobbleModulationTest - checks Bend's control-rate modulation. The same sine
+ * goes into both channels of a stereo pair: in mono, or with the link all the
+ * way up, the right must come out the same as the left, and with the link off
+ * it must not. The modulation has to carry on across blocks, so how the input
+ * is cut into blocks, including blocks longer than the prepared size, must
+ * make next to no difference.
+ */
+class WobbleModulationTest : public juce::UnitTest
+{
+public:
+    WobbleModulationTest() : juce::UnitTest("Wobble modulation", "DSP") {}
+
+    void runTest() override
+    {
+        beginTest("mono and a full link make the right follow the left");
+        {
+            auto output = run([] (ParamSnapshot& params)
+            {
+                params.wobbleMono = true;
+                params.wobbleStereoLink = 0.0f;
+            }, { blockSize });
+            expectLessThan(worstDifference(output[0], output[1]), 1.0e-6);
+
+            output = run([] (ParamSnapshot& params) { params.wobbleStereoLink = 1.0f; }, { blockSize });
+            expectLessThan(worstDifference(output[0], output[1]), 1.0e-6);
+        }
+
+        beginTest("an unlinked right runs its own modulation");
+        {
+            const auto output = run([] (ParamSnapshot& params) { params.wobbleStereoLink = 0.0f; }, { blockSize });
+            expectGreaterThan(worstDifference(output[0], output[1]), 0.1);
+        }
+
+        beginTest("block sizes do not change the modulation");
+        {
+            // No random sources, whose draws would fall differently with the blocks
+            const auto halfLinked = [] (ParamSnapshot& params) { params.wobbleStereoLink = 0.5f; };
+            const auto whole = run(halfLinked, { blockSize });
+            const auto ragged = run(halfLinked, { 1, 13, 600, 64, 200, 7 });
+
+            // Past the start, where the modulation glides in from rest over the first control interval
+            // and so over a shorter first block; the delay line has let that out well before 256
+            expectLessThan(worstDifference(whole, ragged, blockSize), 0.001);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 256;
+    static constexpr int numSamples = 48000;
+
+    // Both channels' output for a 1 kHz sine in both, cut into blocks of the given sizes in turn. The
+    // settings are full wet, so only the modulated delay is heard, with wow and flutter but no drift
+    // or jitter, and then whatever setUp changes.
+    template <typename SetUp>
+    static std::vector<std::vector<float>> run(SetUp&& setUp, const std::vector<int>& blockSizes)
+    {
+        ModuleTestRig<Wobble> rig(sampleRate, blockSize, 2);
+        rig.params.wobbleOn = true;
+        rig.params.wobbleDepth = 0.5f;
+        rig.params.wobbleRateHz = 3.0f;
+        rig.params.wobbleSync = false;
+        rig.params.wobbleFlutter = 0.5f;
+        rig.params.wobbleDrift = 0.0f;
+        rig.params.wobbleJitter = 0.0f;
+        rig.params.wobbleMono = false;
+        rig.params.wobbleQuality = 1; // hermite
+
+        // The macro glides once per block, so a moving one would scale the depth differently
+        // with different blocks; held where it starts, it stays put
+        rig.params.macroReallyCheap = ParameterDefaults::macroReallyCheap;
+        setUp(rig.params);
+
+        return rig.render([] (int, int n)
+        {
+            return 0.5f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * 1000.0 * n / sampleRate));
+        }, numSamples, blockSizes);
+    }
+};
+
+WobbleModulationTest wobbleModulationTest;
+
+} // namespace
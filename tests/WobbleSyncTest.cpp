@@ -0,0 +1,106 @@
+#include <JuceHeader.h>
+#include "ModuleTestRig.h"
+#include "../Source/dsp/Wobble.h"
+#include "../Source/core/Params.h"
+
+namespace
+{
+
+using namespace ReallyCheap;
+
+/**
+ * WobbleSyncTest - checks Bend's tempo sync. A synced rate has to snap to the
+ * nearest power-of-two division of the beat, so a synced Wobble must give the
+ * same output as one running free at the snapped rate. While the transport
+ * runs, the LFOs lock to the playhead, so starting part-way through must end
+ * up with the same wobble as having played up to there.
+ */
+class WobbleSyncTest : public juce::UnitTest
+{
+public:
+    WobbleSyncTest() : juce::UnitTest("Wobble tempo sync", "DSP") {}
+
+    void runTest() override
+    {
+        // Rates that are off the beat, and the rates they should snap to
+        struct Case { double bpm; float rateHz; float snappedHz; };
+        for (auto c : { Case { 120.0, 1.7f, 2.0f }, Case { 90.0, 2.5f, 3.0f }, Case { 100.0, 0.3f, 0.4166667f } })
+        {
+            beginTest("synced period at " + juce::String((int) c.bpm) + " bpm");
+            {
+                const auto synced = run(c.rateHz, true, c.bpm, 0);
+                const auto snapped = run(c.snappedHz, false, c.bpm, 0);
+                const auto unsnapped = run(c.rateHz, false, c.bpm, 0);
+
+                expectLessThan(worstDifference(synced, snapped), 0.001);
+                expectGreaterThan(worstDifference(synced, unsnapped), 0.1);
+            }
+        }
+
+        beginTest("the playhead sets the phase");
+        {
+            // Two and a half beats in at 120 bpm, so neither LFO is where it starts from rest
+            const int lateStart = 60000;
+            const auto fromTheTop = run(1.7f, true, 120.0, 0);
+            const auto fromLater = run(1.7f, true, 120.0, lateStart);
+
+            // Once the glide from rest and the late start's empty delay line have passed
+            expectLessThan(worstDifference(fromTheTop, fromLater, lateStart + blockSize), 0.001);
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 256;
+    static constexpr int numSamples = 96000;
+
+    // Reports a steady tempo and a running transport at the position it is moved to
+    struct PlayHead : public juce::AudioPlayHead
+    {
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+            info.setBpm(bpm);
+            info.setPpqPosition(ppqPosition);
+            info.setIsPlaying(true);
+            return info;
+        }
+
+        double bpm = 120.0;
+        double ppqPosition = 0.0;
+    };
+
+    // Both channels' output for a 1 kHz sine, played from the host sample firstSample onwards with
+    // full wet wow and flutter and no random sources; everything before firstSample is left at zero
+    static std::vector<std::vector<float>> run(float rateHz, bool sync, double bpm, int firstSample)
+    {
+        ModuleTestRig<Wobble> rig(sampleRate, blockSize, 2);
+        rig.params.wobbleOn = true;
+        rig.params.wobbleDepth = 0.5f;
+        rig.params.wobbleRateHz = rateHz;
+        rig.params.wobbleSync = sync;
+        rig.params.wobbleFlutter = 0.5f;
+        rig.params.wobbleDrift = 0.0f;
+        rig.params.wobbleJitter = 0.0f;
+        rig.params.wobbleStereoLink = 0.5f;
+        rig.params.wobbleMono = false;
+        rig.params.wobbleQuality = 1; // hermite
+        rig.params.macroReallyCheap = ParameterDefaults::macroReallyCheap;
+
+        PlayHead playHead;
+        playHead.bpm = bpm;
+        rig.playHead = &playHead;
+
+        return rig.render([] (int, int n)
+        {
+            return 0.5f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * 1000.0 * n / sampleRate));
+        }, firstSample, numSamples, { blockSize }, [&] (int start)
+        {
+            playHead.ppqPosition = start / sampleRate * bpm / 60.0;
+        });
+    }
+};
+
+WobbleSyncTest wobbleSyncTest;
+
+} // namespace